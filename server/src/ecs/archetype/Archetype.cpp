@@ -0,0 +1,138 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Archetype
+*/
+
+#include "Archetype.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace Ecs
+{
+    Archetype::Archetype(Signature signature, const std::array<ComponentInfo, MAX_COMPONENTS> &infos)
+        : _signature(signature)
+    {
+        size_t rowSize = sizeof(size_t);
+
+        _columns.fill(npos);
+        for (ComponentId id = 0; id < MAX_COMPONENTS; ++id) {
+            if (!signature.test(id))
+                continue;
+            _columns[id] = _ids.size();
+            _ids.push_back(id);
+            _infos.push_back(infos[id]);
+            rowSize += infos[id].size;
+        }
+        _offsets.resize(_ids.size());
+        _capacity = CHUNK_SIZE / rowSize;
+        while (_capacity > 0 && layout(_capacity) > CHUNK_SIZE)
+            _capacity--;
+        if (_capacity == 0)
+            throw std::length_error("{Archetype::Archetype} Components do not fit in a chunk");
+        layout(_capacity);
+    }
+
+    Archetype::~Archetype()
+    {
+        for (size_t row = 0; row < _size; ++row)
+            for (size_t col = 0; col < _ids.size(); ++col)
+                _infos[col].destroy(slot(col, row));
+    }
+
+    size_t Archetype::allocate(size_t entityIndex)
+    {
+        if (_size == _chunks.size() * _capacity)
+            _chunks.push_back(std::make_unique<std::byte[]>(CHUNK_SIZE));
+        size_t row = _size++;
+
+        reinterpret_cast<size_t *>(_chunks[row / _capacity].get())[row % _capacity] = entityIndex;
+        return row;
+    }
+
+    size_t Archetype::eraseRow(size_t row, bool destroyComponents) noexcept
+    {
+        size_t last = _size - 1;
+        size_t moved = npos;
+
+        for (size_t col = 0; col < _ids.size(); ++col) {
+            if (destroyComponents)
+                _infos[col].destroy(slot(col, row));
+            if (row != last) {
+                _infos[col].moveConstruct(slot(col, row), slot(col, last));
+                _infos[col].destroy(slot(col, last));
+            }
+        }
+        if (row != last) {
+            moved = entityAt(last);
+            reinterpret_cast<size_t *>(_chunks[row / _capacity].get())[row % _capacity] = moved;
+        }
+        _size--;
+        if (_chunks.size() > (_size + _capacity - 1) / _capacity + 1)
+            _chunks.pop_back();
+        return moved;
+    }
+
+    void *Archetype::component(ComponentId id, size_t row) const noexcept
+    {
+        return slot(_columns[id], row);
+    }
+
+    size_t Archetype::entityAt(size_t row) const noexcept
+    {
+        return entities(row / _capacity)[row % _capacity];
+    }
+
+    void *Archetype::column(ComponentId id, size_t chunk) const noexcept
+    {
+        return _chunks[chunk].get() + _offsets[_columns[id]];
+    }
+
+    const size_t *Archetype::entities(size_t chunk) const noexcept
+    {
+        return reinterpret_cast<const size_t *>(_chunks[chunk].get());
+    }
+
+    size_t Archetype::chunkSize(size_t chunk) const noexcept
+    {
+        return std::min(_capacity, _size - chunk * _capacity);
+    }
+
+    size_t Archetype::chunkCount() const noexcept
+    {
+        return (_size + _capacity - 1) / _capacity;
+    }
+
+    size_t Archetype::chunkCapacity() const noexcept
+    {
+        return _capacity;
+    }
+
+    size_t Archetype::size() const noexcept
+    {
+        return _size;
+    }
+
+    Signature Archetype::signature() const noexcept
+    {
+        return _signature;
+    }
+
+    size_t Archetype::layout(size_t capacity) noexcept
+    {
+        size_t offset = capacity * sizeof(size_t);
+
+        for (size_t col = 0; col < _ids.size(); ++col) {
+            offset = (offset + _infos[col].align - 1) / _infos[col].align * _infos[col].align;
+            _offsets[col] = offset;
+            offset += _infos[col].size * capacity;
+        }
+        return offset;
+    }
+
+    std::byte *Archetype::slot(size_t column, size_t row) const noexcept
+    {
+        return _chunks[row / _capacity].get() + _offsets[column] + (row % _capacity) * _infos[column].size;
+    }
+} // namespace Ecs
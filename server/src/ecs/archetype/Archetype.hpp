@@ -0,0 +1,159 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Archetype
+*/
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <vector>
+#include "ComponentFamily.hpp"
+#include "ComponentInfo.hpp"
+#include "Signature.hpp"
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @class Archetype
+     * @brief Storage of every entity sharing one exact set of components.
+     *
+     * Rows are packed in fixed-size chunks. Inside a chunk, each component type
+     * has its own column (SoA layout), preceded by a column of entity indices.
+     * Rows are kept dense: removing one moves the last row into the hole.
+     */
+    class Archetype {
+      public:
+        /** @brief Size in bytes of a chunk */
+        static constexpr size_t CHUNK_SIZE = 16 * 1024;
+
+        /** @brief Returned when no entity was moved by eraseRow() */
+        static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+        /**
+         * @brief Computes the chunk layout of a set of components.
+         * @param signature Component types stored by the archetype
+         * @param infos Description of every component type, indexed by ComponentId
+         * @throws std::length_error if a single row does not fit in a chunk
+         */
+        Archetype(Signature signature, const std::array<ComponentInfo, MAX_COMPONENTS> &infos);
+
+        /**
+         * @brief Destroys every stored component.
+         */
+        ~Archetype();
+
+        Archetype(const Archetype &) = delete;
+        Archetype &operator=(const Archetype &) = delete;
+
+        /**
+         * @brief Appends an uninitialized row.
+         *
+         * The caller must construct every component of the row.
+         *
+         * @param entityIndex Index of the entity owning the row
+         * @return The new row
+         */
+        size_t allocate(size_t entityIndex);
+
+        /**
+         * @brief Removes a row, moving the last row into it.
+         * @param row Row to remove
+         * @param destroyComponents false if the row's components were already destroyed or moved out
+         * @return The entity index moved into row, or npos if row was the last one
+         */
+        size_t eraseRow(size_t row, bool destroyComponents) noexcept;
+
+        /**
+         * @brief Gets the storage of a component in a row.
+         * @param id Component type, which must be part of the signature
+         * @param row Row
+         */
+        void *component(ComponentId id, size_t row) const noexcept;
+
+        /**
+         * @brief Gets the entity index stored in a row.
+         */
+        size_t entityAt(size_t row) const noexcept;
+
+        /**
+         * @brief Gets the column of a component type in a chunk.
+         * @param id Component type, which must be part of the signature
+         * @param chunk Chunk index
+         */
+        void *column(ComponentId id, size_t chunk) const noexcept;
+
+        /**
+         * @brief Gets the entity index column of a chunk.
+         */
+        const size_t *entities(size_t chunk) const noexcept;
+
+        /**
+         * @brief Gets the number of rows stored in a chunk.
+         */
+        size_t chunkSize(size_t chunk) const noexcept;
+
+        /**
+         * @brief Gets the number of allocated chunks.
+         */
+        size_t chunkCount() const noexcept;
+
+        /**
+         * @brief Gets the number of rows a chunk holds.
+         */
+        size_t chunkCapacity() const noexcept;
+
+        /**
+         * @brief Gets the number of rows.
+         */
+        size_t size() const noexcept;
+
+        /**
+         * @brief Gets the component types stored by the archetype.
+         */
+        Signature signature() const noexcept;
+
+      private:
+        /**
+         * @brief Computes the column offsets for a chunk capacity.
+         * @return Bytes needed by a chunk of that capacity
+         */
+        size_t layout(size_t capacity) noexcept;
+
+        /**
+         * @brief Gets the address of a row in a column.
+         */
+        std::byte *slot(size_t column, size_t row) const noexcept;
+
+        /** @brief Component types stored by the archetype */
+        Signature _signature = {};
+
+        /** @brief Component types, one per column */
+        std::vector<ComponentId> _ids = {};
+
+        /** @brief Description of each column's component */
+        std::vector<ComponentInfo> _infos = {};
+
+        /** @brief Byte offset of each column in a chunk */
+        std::vector<size_t> _offsets = {};
+
+        /** @brief Column of each ComponentId (npos if not stored) */
+        std::array<size_t, MAX_COMPONENTS> _columns = {};
+
+        /** @brief Number of rows per chunk */
+        size_t _capacity = 0;
+
+        /** @brief Allocated chunks */
+        std::vector<std::unique_ptr<std::byte[]>> _chunks = {};
+
+        /** @brief Number of rows */
+        size_t _size = 0;
+    };
+} // namespace Ecs
@@ -0,0 +1,96 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ArchetypeRegistry
+*/
+
+#include "ArchetypeRegistry.hpp"
+
+namespace Ecs
+{
+    ArchetypeRegistry::ArchetypeRegistry()
+    {
+        findArchetype(Signature());
+    }
+
+    Entity ArchetypeRegistry::createEntity()
+    {
+        size_t index = 0;
+
+        if (!_freeList.empty()) {
+            index = _freeList.back();
+            _freeList.pop_back();
+        } else {
+            index = _generations.size();
+            _generations.push_back(0);
+            _locations.emplace_back();
+        }
+        _locations[index] = Location {0, _archetypes[0]->allocate(index)};
+        return Entity(index, _generations[index]);
+    }
+
+    void ArchetypeRegistry::destroyEntity(Entity entity) noexcept
+    {
+        if (!isAlive(entity))
+            return;
+        Location location = _locations[entity.index()];
+        size_t moved = _archetypes[location.archetype]->eraseRow(location.row, true);
+
+        if (moved != Archetype::npos)
+            _locations[moved].row = location.row;
+        _generations[entity.index()]++;
+        _freeList.push_back(entity.index());
+    }
+
+    bool ArchetypeRegistry::isAlive(Entity entity) const noexcept
+    {
+        return entity.index() < _generations.size() && _generations[entity.index()] == entity.generation();
+    }
+
+    Signature ArchetypeRegistry::getSignature(Entity entity) const noexcept
+    {
+        if (!isAlive(entity))
+            return Signature();
+        return _archetypes[_locations[entity.index()].archetype]->signature();
+    }
+
+    size_t ArchetypeRegistry::archetypeCount() const noexcept
+    {
+        return _archetypes.size();
+    }
+
+    size_t ArchetypeRegistry::findArchetype(Signature signature)
+    {
+        auto it = _archetypeIndex.find(signature);
+
+        if (it != _archetypeIndex.end())
+            return it->second;
+        _archetypes.push_back(std::make_unique<Archetype>(signature, _infos));
+        _archetypeIndex.emplace(signature, _archetypes.size() - 1);
+        return _archetypes.size() - 1;
+    }
+
+    size_t ArchetypeRegistry::moveEntity(size_t index, size_t target)
+    {
+        Location &location = _locations[index];
+        Archetype &from = *_archetypes[location.archetype];
+        Archetype &to = *_archetypes[target];
+        size_t row = to.allocate(index);
+        Signature kept = from.signature() & to.signature();
+
+        for (ComponentId id = 0; id < MAX_COMPONENTS; ++id) {
+            if (!from.signature().test(id))
+                continue;
+            if (kept.test(id))
+                _infos[id].moveConstruct(to.component(id, row), from.component(id, location.row));
+            _infos[id].destroy(from.component(id, location.row));
+        }
+        size_t moved = from.eraseRow(location.row, false);
+
+        if (moved != Archetype::npos)
+            _locations[moved].row = location.row;
+        location = Location {target, row};
+        return row;
+    }
+} // namespace Ecs
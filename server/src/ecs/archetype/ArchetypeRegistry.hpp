@@ -0,0 +1,181 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ArchetypeRegistry
+*/
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "Archetype.hpp"
+#include "ComponentFamily.hpp"
+#include "ComponentInfo.hpp"
+#include "Entity.hpp"
+#include "Signature.hpp"
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @class ArchetypeRegistry
+     * @brief Archetype-based alternative to the SparseSet Registry.
+     *
+     * Entities owning the same set of components live together in an Archetype,
+     * in fixed-size SoA chunks. A view walks the chunks of every matching archetype
+     * without any per-entity check, at the cost of moving an entity's components
+     * to another archetype each time a component is added or removed.
+     *
+     * It exposes the entity and component API of Registry (createEntity,
+     * destroyEntity, isAlive, emplaceComponent, hasComponent, removeComponent, view),
+     * so both backends can run identical workloads.
+     */
+    class ArchetypeRegistry {
+      public:
+        /**
+         * @brief Creates the registry with its empty archetype.
+         */
+        ArchetypeRegistry();
+
+        /**
+         * @brief Creates a new entity, without components.
+         * @return A newly created Entity with a unique (index, generation) pair.
+         */
+        Entity createEntity();
+
+        /**
+         * @brief Destroys an entity and all of its components. Stale handles are ignored.
+         * @param entity The entity to destroy.
+         */
+        void destroyEntity(Entity entity) noexcept;
+
+        /**
+         * @brief Checks if a handle refers to a live entity.
+         * @param entity The entity handle to check.
+         */
+        bool isAlive(Entity entity) const noexcept;
+
+        /**
+         * @brief Constructs and assigns a component to an entity.
+         *
+         * If the entity does not own T yet, it moves to the archetype including T.
+         * Otherwise its component is replaced in place, as with Registry::emplaceComponent().
+         * Nothing happens if the handle is stale.
+         *
+         * @tparam T Component type
+         * @tparam Args Constructor parameter pack
+         * @param entity Target entity
+         * @param args Arguments forwarded to the component constructor
+         */
+        template <typename T, typename... Args>
+        void emplaceComponent(Entity entity, Args &&...args);
+
+        /**
+         * @brief Checks if an entity owns a specific component.
+         * @tparam T Component type
+         * @param entity Target entity
+         */
+        template <typename T>
+        bool hasComponent(Entity entity) const noexcept;
+
+        /**
+         * @brief Removes a component from an entity, if present.
+         * @tparam T Component type
+         * @param entity Target entity
+         */
+        template <typename T>
+        void removeComponent(Entity entity);
+
+        /**
+         * @brief Accesses the component of an entity.
+         * @tparam T Component type
+         * @param entity Target entity
+         * @return Pointer to the component, or nullptr if absent. Invalidated by structural changes.
+         */
+        template <typename T>
+        T *getComponent(Entity entity) noexcept;
+
+        /**
+         * @brief Iterates over entities owning a set of components.
+         *
+         * Function signature must be:
+         * `void(Entity, Components&...)`
+         *
+         * @tparam Components List of required component types
+         * @tparam Function Callable type
+         * @param fn Function called for each valid entity
+         */
+        template <typename... Components, typename Function>
+        void view(Function fn);
+
+        /**
+         * @brief Gets the component signature of an entity.
+         * @param entity Target entity
+         * @return The set of component types owned by the entity (empty if stale)
+         */
+        Signature getSignature(Entity entity) const noexcept;
+
+        /**
+         * @brief Gets the number of archetypes created so far.
+         */
+        size_t archetypeCount() const noexcept;
+
+      private:
+        /**
+         * @struct Location
+         * @brief Where the components of an entity are stored.
+         */
+        struct Location {
+            size_t archetype = 0; ///> Index in _archetypes
+            size_t row = 0;       ///> Row in the archetype
+        };
+
+        /**
+         * @brief Gets the archetype of a signature, creating it if needed.
+         */
+        size_t findArchetype(Signature signature);
+
+        /**
+         * @brief Moves an entity to another archetype.
+         *
+         * Shared components are moved, components missing from the target are destroyed.
+         * Components only present in the target are left unconstructed.
+         *
+         * @return The row of the entity in the target archetype
+         */
+        size_t moveEntity(size_t index, size_t target);
+
+        /**
+         * @brief Records the description of a component type.
+         */
+        template <typename T>
+        ComponentId registerInfo();
+
+        /** @brief Current generation of each entity index */
+        std::vector<uint32_t> _generations = {};
+
+        /** @brief Indices of destroyed entities, ready to be recycled */
+        std::vector<size_t> _freeList = {};
+
+        /** @brief Location of each entity index */
+        std::vector<Location> _locations = {};
+
+        /** @brief Every archetype, the empty one first */
+        std::vector<std::unique_ptr<Archetype>> _archetypes = {};
+
+        /** @brief Archetype index of each signature */
+        std::unordered_map<Signature, size_t> _archetypeIndex = {};
+
+        /** @brief Description of each component type used so far */
+        std::array<ComponentInfo, MAX_COMPONENTS> _infos = {};
+    };
+} // namespace Ecs
+
+#include "ArchetypeRegistry.tpp"
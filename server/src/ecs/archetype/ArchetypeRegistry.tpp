@@ -0,0 +1,98 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ArchetypeRegistry
+*/
+
+#include <new>
+#include <stdexcept>
+
+namespace Ecs
+{
+    template <typename T>
+    ComponentId ArchetypeRegistry::registerInfo()
+    {
+        static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "Component is over-aligned for a chunk");
+        ComponentId id = ComponentFamily::id<T>();
+
+        if (id >= MAX_COMPONENTS)
+            throw std::length_error("{ArchetypeRegistry::registerInfo} Too many component types");
+        if (!_infos[id].destroy)
+            _infos[id] = ComponentInfo::of<T>();
+        return id;
+    }
+
+    template <typename T, typename... Args>
+    void ArchetypeRegistry::emplaceComponent(Entity entity, Args &&...args)
+    {
+        if (!isAlive(entity))
+            return;
+        ComponentId id = registerInfo<T>();
+        Location &location = _locations[entity.index()];
+        Archetype *current = _archetypes[location.archetype].get();
+
+        T component(std::forward<Args>(args)...);
+
+        if (!current->signature().test(id)) {
+            size_t target = findArchetype(current->signature() | Signature().set(id));
+            size_t row = moveEntity(entity.index(), target);
+
+            new (_archetypes[target]->component(id, row)) T(std::move(component));
+            return;
+        }
+        *static_cast<T *>(current->component(id, location.row)) = std::move(component);
+    }
+
+    template <typename T>
+    bool ArchetypeRegistry::hasComponent(Entity entity) const noexcept
+    {
+        ComponentId id = ComponentFamily::id<T>();
+
+        return isAlive(entity) && id < MAX_COMPONENTS
+            && _archetypes[_locations[entity.index()].archetype]->signature().test(id);
+    }
+
+    template <typename T>
+    void ArchetypeRegistry::removeComponent(Entity entity)
+    {
+        if (!hasComponent<T>(entity))
+            return;
+        ComponentId id = ComponentFamily::id<T>();
+        Signature signature = _archetypes[_locations[entity.index()].archetype]->signature();
+
+        moveEntity(entity.index(), findArchetype(signature.reset(id)));
+    }
+
+    template <typename T>
+    T *ArchetypeRegistry::getComponent(Entity entity) noexcept
+    {
+        if (!hasComponent<T>(entity))
+            return nullptr;
+        const Location &location = _locations[entity.index()];
+
+        return static_cast<T *>(_archetypes[location.archetype]->component(ComponentFamily::id<T>(), location.row));
+    }
+
+    template <typename... Components, typename Function>
+    void ArchetypeRegistry::view(Function fn)
+    {
+        if (((ComponentFamily::id<Components>() >= MAX_COMPONENTS) || ...))
+            return;
+        Signature mask = signatureOf<Components...>();
+
+        for (auto &archetype : _archetypes) {
+            if ((archetype->signature() & mask) != mask)
+                continue;
+            for (size_t chunk = 0; chunk < archetype->chunkCount(); ++chunk) {
+                const size_t *entities = archetype->entities(chunk);
+                auto columns = std::make_tuple(
+                    static_cast<Components *>(archetype->column(ComponentFamily::id<Components>(), chunk))...);
+                size_t count = archetype->chunkSize(chunk);
+
+                for (size_t row = 0; row < count; ++row)
+                    fn(Entity(entities[row], _generations[entities[row]]), std::get<Components *>(columns)[row]...);
+            }
+        }
+    }
+}
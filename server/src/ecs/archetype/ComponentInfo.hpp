@@ -0,0 +1,41 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ComponentInfo
+*/
+
+#pragma once
+#include <cstddef>
+#include <new>
+#include <utility>
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @struct ComponentInfo
+     * @brief Type-erased description of a component type.
+     *
+     * Lets type-agnostic storage (such as archetype chunks) move and destroy
+     * components it only knows as raw bytes.
+     */
+    struct ComponentInfo {
+        size_t size = 0;                                 ///> sizeof the component
+        size_t align = 0;                                ///> alignof the component
+        void (*moveConstruct)(void *, void *) = nullptr; ///> Move-constructs at dst (1st) from src (2nd)
+        void (*destroy)(void *) = nullptr;               ///> Calls the destructor
+
+        /**
+         * @brief Builds the description of a component type.
+         * @tparam T Component type
+         */
+        template <typename T>
+        static ComponentInfo of() noexcept;
+    };
+} // namespace Ecs
+
+#include "ComponentInfo.tpp"
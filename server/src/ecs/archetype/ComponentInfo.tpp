@@ -0,0 +1,21 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ComponentInfo
+*/
+
+namespace Ecs
+{
+    template <typename T>
+    ComponentInfo ComponentInfo::of() noexcept
+    {
+        return ComponentInfo {sizeof(T), alignof(T),
+            [](void *dst, void *src) {
+                new (dst) T(std::move(*static_cast<T *>(src)));
+            },
+            [](void *ptr) {
+                static_cast<T *>(ptr)->~T();
+            }};
+    }
+}
@@ -0,0 +1,28 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** CollisionLayer
+*/
+
+#pragma once
+#include <cstdint>
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @struct CollisionLayer
+     * @brief Defines which entities a collision box interacts with.
+     *
+     * Two entities can collide only if each one's layer matches the other's mask.
+     * Entities without this component are on layer 1 and collide with every layer.
+     */
+    struct CollisionLayer {
+        uint32_t layer = 1;         ///> Layers the entity belongs to (one bit per layer)
+        uint32_t mask = UINT32_MAX; ///> Layers the entity collides with
+    };
+} // namespace Ecs
@@ -7,6 +7,7 @@
 
 #pragma once
 #include <string>
+#include "Serializer.hpp"
 
 /**
  * @namespace Ecs
@@ -22,4 +23,22 @@ namespace Ecs
         std::string sprite;   ///> Sprite identifier or path
         bool drawable = true; ///> If false, entity is not rendered
     };
+
+    /**
+     * @brief Snapshot hook of Drawable, which owns a string.
+     */
+    template <>
+    struct Serializer<Drawable> {
+        static void write(BinaryWriter &writer, const Drawable &component)
+        {
+            writer.writeString(component.sprite);
+            writer.write(component.drawable);
+        }
+
+        static void read(BinaryReader &reader, Drawable &component)
+        {
+            component.sprite = reader.readString();
+            component.drawable = reader.read<bool>();
+        }
+    };
 } // namespace Ecs
\ No newline at end of file
@@ -0,0 +1,23 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** FastMover
+*/
+
+#pragma once
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @struct FastMover
+     * @brief Marks an entity fast enough to cross a collision box in one tick.
+     *
+     * Its motion is swept by Physics::ContinuousCollision instead of being sampled once per tick.
+     */
+    struct FastMover {};
+} // namespace Ecs
@@ -0,0 +1,66 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** CommandBuffer
+*/
+
+#include "CommandBuffer.hpp"
+#include <algorithm>
+
+namespace Ecs
+{
+    Entity CommandBuffer::createEntity() noexcept
+    {
+        return Entity(_created++, PENDING);
+    }
+
+    void CommandBuffer::destroyEntity(Entity entity)
+    {
+        _destroyed.push_back(entity);
+    }
+
+    std::vector<Entity> CommandBuffer::apply(Registry &registry)
+    {
+        std::vector<Entity> created;
+
+        created.reserve(_created);
+        for (size_t i = 0; i < _created; ++i)
+            created.push_back(registry.createEntity());
+        for (auto &queue : _queues)
+            if (queue)
+                queue->apply(registry, created);
+        for (auto &entity : _destroyed)
+            entity = resolve(entity, created);
+        std::sort(_destroyed.begin(), _destroyed.end(), [](Entity lhs, Entity rhs) {
+            return lhs.index() != rhs.index() ? lhs.index() < rhs.index() : lhs.generation() < rhs.generation();
+        });
+        _destroyed.erase(std::unique(_destroyed.begin(), _destroyed.end()), _destroyed.end());
+        for (auto entity : _destroyed)
+            registry.destroyEntity(entity);
+        clear();
+        return created;
+    }
+
+    void CommandBuffer::clear() noexcept
+    {
+        _created = 0;
+        _operations = 0;
+        _destroyed.clear();
+        for (auto &queue : _queues)
+            if (queue)
+                queue->clear();
+    }
+
+    bool CommandBuffer::empty() const noexcept
+    {
+        return _created == 0 && _operations == 0 && _destroyed.empty();
+    }
+
+    Entity CommandBuffer::resolve(Entity entity, const std::vector<Entity> &created) noexcept
+    {
+        if (entity.generation() != PENDING || entity.index() >= created.size())
+            return entity;
+        return created[entity.index()];
+    }
+} // namespace Ecs
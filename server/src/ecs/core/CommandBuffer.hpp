@@ -0,0 +1,148 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** CommandBuffer
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+#include "ComponentFamily.hpp"
+#include "Entity.hpp"
+#include "ICommandQueue.hpp"
+#include "Registry.hpp"
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @class CommandBuffer
+     * @brief Records structural changes and applies them later at a sync point.
+     *
+     * Systems iterating a view or a group must not create or destroy entities, nor add
+     * or remove components, since that reorders the pools being walked. They record
+     * those changes in a CommandBuffer instead, and the buffer is applied once the
+     * iteration is over.
+     *
+     * apply() runs the recorded operations in batches, in this order:
+     * 1. entity creations,
+     * 2. component emplacements and removals, grouped by component type and sorted by
+     *    entity; the operations on one entity and type are replayed in recording order,
+     *    so a removal followed by an emplacement leaves the component in place,
+     * 3. entity destructions, sorted and deduplicated.
+     *
+     * A buffer is not thread-safe: systems running in parallel each use their own.
+     */
+    class CommandBuffer {
+      public:
+        /** @brief Generation of the placeholder handles returned by createEntity() */
+        static constexpr uint32_t PENDING = std::numeric_limits<uint32_t>::max();
+
+        /**
+         * @brief Records an entity creation.
+         *
+         * The returned handle is a placeholder, only valid as a target of this buffer's
+         * commands. It is replaced by the real entity when the buffer is applied.
+         *
+         * @return A placeholder entity handle
+         */
+        Entity createEntity() noexcept;
+
+        /**
+         * @brief Records an entity destruction.
+         * @param entity Entity to destroy
+         */
+        void destroyEntity(Entity entity);
+
+        /**
+         * @brief Records a component emplacement.
+         *
+         * The component is constructed now and moved into the registry on apply.
+         *
+         * @tparam T Component type
+         * @tparam Args Constructor parameter pack
+         * @param entity Target entity (or placeholder)
+         * @param args Arguments forwarded to the component constructor
+         */
+        template <typename T, typename... Args>
+        void emplaceComponent(Entity entity, Args &&...args);
+
+        /**
+         * @brief Records a component removal.
+         * @tparam T Component type
+         * @param entity Target entity (or placeholder)
+         */
+        template <typename T>
+        void removeComponent(Entity entity);
+
+        /**
+         * @brief Applies every recorded operation to a registry, then clears the buffer.
+         * @param registry Target registry
+         * @return The entities created for each placeholder, by creation order
+         */
+        std::vector<Entity> apply(Registry &registry);
+
+        /**
+         * @brief Drops every recorded operation.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Checks if the buffer has no recorded operation.
+         */
+        bool empty() const noexcept;
+
+        /**
+         * @brief Resolves a placeholder into the entity created for it.
+         * @param entity Entity or placeholder
+         * @param created Entities created for the buffer's placeholders
+         * @return The real entity handle
+         */
+        static Entity resolve(Entity entity, const std::vector<Entity> &created) noexcept;
+
+      private:
+        /**
+         * @class Queue
+         * @brief Deferred operations on one component type.
+         */
+        template <typename T>
+        class Queue : public ICommandQueue {
+          public:
+            void apply(Registry &registry, const std::vector<Entity> &created) override;
+
+            void clear() noexcept override;
+
+            /** @brief Target of each operation, with the component to emplace (empty for a removal) */
+            std::vector<std::pair<Entity, std::optional<T>>> operations = {};
+        };
+
+        /**
+         * @brief Gets or creates the queue of a component type.
+         */
+        template <typename T>
+        Queue<T> &queue();
+
+        /** @brief Number of recorded entity creations */
+        size_t _created = 0;
+
+        /** @brief Recorded entity destructions */
+        std::vector<Entity> _destroyed = {};
+
+        /** @brief Per-type queues indexed by ComponentId (nullptr if unused) */
+        std::vector<std::unique_ptr<ICommandQueue>> _queues = {};
+
+        /** @brief Number of recorded component operations */
+        size_t _operations = 0;
+    };
+} // namespace Ecs
+
+#include "CommandBuffer.tpp"
@@ -0,0 +1,59 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** CommandBuffer
+*/
+
+#include <algorithm>
+
+namespace Ecs
+{
+    template <typename T, typename... Args>
+    void CommandBuffer::emplaceComponent(Entity entity, Args &&...args)
+    {
+        queue<T>().operations.emplace_back(entity, T(std::forward<Args>(args)...));
+        _operations++;
+    }
+
+    template <typename T>
+    void CommandBuffer::removeComponent(Entity entity)
+    {
+        queue<T>().operations.emplace_back(entity, std::nullopt);
+        _operations++;
+    }
+
+    template <typename T>
+    CommandBuffer::Queue<T> &CommandBuffer::queue()
+    {
+        ComponentId id = ComponentFamily::id<T>();
+
+        if (id >= _queues.size())
+            _queues.resize(id + 1);
+        if (!_queues[id])
+            _queues[id] = std::make_unique<Queue<T>>();
+        return static_cast<Queue<T> &>(*_queues[id]);
+    }
+
+    template <typename T>
+    void CommandBuffer::Queue<T>::apply(Registry &registry, const std::vector<Entity> &created)
+    {
+        for (auto &[entity, component] : operations)
+            entity = CommandBuffer::resolve(entity, created);
+        std::stable_sort(operations.begin(), operations.end(), [](const auto &lhs, const auto &rhs) {
+            return lhs.first.index() < rhs.first.index();
+        });
+        for (auto &[entity, component] : operations) {
+            if (component)
+                registry.emplaceComponent<T>(entity, std::move(*component));
+            else
+                registry.removeComponent<T>(entity);
+        }
+    }
+
+    template <typename T>
+    void CommandBuffer::Queue<T>::clear() noexcept
+    {
+        operations.clear();
+    }
+}
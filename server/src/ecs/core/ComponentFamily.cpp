@@ -0,0 +1,18 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ComponentFamily
+*/
+
+#include "ComponentFamily.hpp"
+
+namespace Ecs
+{
+    std::atomic<ComponentId> ComponentFamily::_counter = 0;
+
+    size_t ComponentFamily::count() noexcept
+    {
+        return _counter.load();
+    }
+} // namespace Ecs
@@ -0,0 +1,55 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ComponentFamily
+*/
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /** @brief Dense integer identifier of a component type */
+    using ComponentId = size_t;
+
+    /**
+     * @class ComponentFamily
+     * @brief Assigns a dense integer ID to each component type.
+     *
+     * IDs are handed out on first use and stay the same for the whole process,
+     * so they can index flat arrays instead of hashing a std::type_index.
+     * Const and volatile qualifiers are ignored.
+     *
+     * The counter is shared by every Registry: MAX_COMPONENTS caps the number of
+     * distinct component types used by the whole process, not by one registry.
+     */
+    class ComponentFamily {
+      public:
+        /**
+         * @brief Gets the ID of a component type.
+         * @tparam T Component type
+         * @return The ID of T, assigned the first time it is requested
+         */
+        template <typename T>
+        static ComponentId id() noexcept;
+
+        /**
+         * @brief Gets the number of IDs handed out so far.
+         * @return Upper bound of every assigned ID
+         */
+        static size_t count() noexcept;
+
+      private:
+        /** @brief Next ID to assign */
+        static std::atomic<ComponentId> _counter;
+    };
+} // namespace Ecs
+
+#include "ComponentFamily.tpp"
@@ -0,0 +1,20 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ComponentFamily
+*/
+
+namespace Ecs
+{
+    template <typename T>
+    ComponentId ComponentFamily::id() noexcept
+    {
+        if constexpr (!std::is_same_v<T, std::remove_cv_t<T>>) {
+            return id<std::remove_cv_t<T>>();
+        } else {
+            static const ComponentId value = _counter.fetch_add(1);
+            return value;
+        }
+    }
+}
@@ -9,7 +9,7 @@
 
 namespace Ecs
 {
-    Entity::Entity(size_t id) : _id(id)
+    Entity::Entity(size_t id, uint32_t generation) : _id(id), _generation(generation)
     {
     }
 
@@ -17,4 +17,14 @@ namespace Ecs
     {
         return _id;
     }
+
+    size_t Entity::index() const noexcept
+    {
+        return _id;
+    }
+
+    uint32_t Entity::generation() const noexcept
+    {
+        return _generation;
+    }
 } // namespace Ecs
@@ -19,25 +19,49 @@ namespace Ecs
      * @class Entity
      * @brief Represents a unique entity identifier in the ECS.
      *
-     * An Entity is simply a wrapper around a unique ID (index).
+     * An Entity is a handle made of an index and a generation.
+     * The index is the slot used to store the entity's components and is recycled
+     * once the entity is destroyed. The generation is bumped on every recycle, so
+     * a handle kept after destruction no longer matches the live entity.
      * It does not store any data besides this identifier.
      */
     class Entity {
       public:
         /**
          * @brief Construct an Entity with a given ID.
-         * @param id Unique identifier for the entity (default: 0)
+         * @param id Index of the entity (default: 0)
+         * @param generation Recycle count of the index (default: 0)
          */
-        explicit Entity(size_t id = 0);
+        explicit Entity(size_t id = 0, uint32_t generation = 0);
 
         /**
-         * @brief Implicit conversion to size_t.
-         * @return The entity ID.
+         * @brief Explicit conversion to size_t.
+         * @return The entity index.
          */
         explicit operator size_t() const noexcept;
 
+        /**
+         * @brief Gets the index of the entity.
+         * @return The entity index.
+         */
+        size_t index() const noexcept;
+
+        /**
+         * @brief Gets the generation of the entity.
+         * @return The number of times the index was recycled before this handle.
+         */
+        uint32_t generation() const noexcept;
+
+        /**
+         * @brief Compares two handles (index and generation).
+         */
+        bool operator==(const Entity &other) const noexcept = default;
+
       private:
-        /** @brief Unique identifier of the entity */
+        /** @brief Index of the entity */
         size_t _id = 0;
+
+        /** @brief Generation of the index when the handle was issued */
+        uint32_t _generation = 0;
     };
 } // namespace Ecs
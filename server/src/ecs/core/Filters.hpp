@@ -0,0 +1,73 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Filters
+*/
+
+#pragma once
+#include <type_traits>
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @struct Exclude
+     * @brief Lists the component types an entity must not own to be part of a view.
+     *
+     * Usage: `registry.view<Position, Velocity>(exclude<Dead>)`
+     *
+     * @tparam Components Excluded component types
+     */
+    template <typename... Components>
+    struct Exclude {};
+
+    /** @brief Exclusion filter instance passed to Registry::view */
+    template <typename... Components>
+    inline constexpr Exclude<Components...> exclude = {};
+
+    /**
+     * @struct Optional
+     * @brief Marks a view component as optional.
+     *
+     * The view does not require it and yields a pointer to it instead of a
+     * reference, nullptr when the entity does not own it.
+     * Usage: `registry.view<Position, Optional<const Health>>()`
+     *
+     * @tparam Component Optional component type (may be const)
+     */
+    template <typename Component>
+    struct Optional {};
+
+    /**
+     * @brief Checks if a view component is wrapped in Optional.
+     */
+    template <typename C>
+    struct IsOptional : std::false_type {};
+
+    template <typename C>
+    struct IsOptional<Optional<C>> : std::true_type {};
+
+    template <typename C>
+    inline constexpr bool isOptional = IsOptional<C>::value;
+
+    /**
+     * @brief Gets the component type of a view component, without Optional.
+     */
+    template <typename C>
+    struct Unwrap {
+        using type = C;
+    };
+
+    template <typename C>
+    struct Unwrap<Optional<C>> {
+        using type = C;
+    };
+
+    /** @brief Stored component type of a view component (no Optional, no const) */
+    template <typename C>
+    using ComponentOf = std::remove_const_t<typename Unwrap<C>::type>;
+} // namespace Ecs
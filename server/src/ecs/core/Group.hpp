@@ -0,0 +1,122 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Group
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include "Entity.hpp"
+#include "IGroup.hpp"
+#include "Signature.hpp"
+#include "SparseSet.hpp"
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @class Group
+     * @brief Owning group over a fixed combination of components.
+     *
+     * The group owns the pools of its components: it keeps the entities owning all
+     * of them packed in the first size() slots of every pool, in the same order.
+     * Iterating the group is then a linear walk over parallel arrays, without any
+     * membership check.
+     *
+     * A pool can be owned by a single group. Groups are created and kept up to date
+     * by the Registry.
+     *
+     * @tparam Owned List of grouped component types
+     */
+    template <typename... Owned>
+    class Group : public IGroup {
+      public:
+        static_assert(!(std::is_empty_v<Owned> || ...), "Tag components cannot be owned by a group");
+
+        /**
+         * @brief Constructs a group and packs the entities already matching it.
+         * @param pools Pools of each owned component
+         * @param generations Generation of each entity index, used to build handles
+         */
+        Group(std::tuple<SparseSet<Owned> *...> pools, const std::vector<uint32_t> &generations) noexcept;
+
+        /**
+         * @brief Default destructor
+         */
+        ~Group() override = default;
+
+        Signature mask() const noexcept override;
+
+        bool contains(size_t index) const noexcept override;
+
+        void enter(size_t index) override;
+
+        void leave(size_t index) override;
+
+        size_t size() const noexcept override;
+
+        void refresh() noexcept override;
+
+        void rebind(const std::vector<uint32_t> &generations) noexcept override;
+
+        std::unique_ptr<IGroup> clone(const std::vector<std::shared_ptr<ISparseSet>> &pools,
+            const std::vector<uint32_t> &generations) const override;
+
+        /**
+         * @brief Calls a function on every entity of the group.
+         *
+         * Every visited component counts as a mutable access for change tracking.
+         *
+         * Function signature must be:
+         * `void(Entity, Owned&...)`
+         *
+         * @param fn Function called for each grouped entity
+         */
+        template <typename Function>
+        void each(Function fn) const;
+
+        /**
+         * @brief Gets the packed components of one owned type.
+         *
+         * The first size() elements are parallel to every other owned type and to entities().
+         * Writes through this pointer are not recorded by change tracking.
+         *
+         * @tparam T One of the owned component types
+         * @return Pointer to the first grouped component
+         */
+        template <typename T>
+        T *data() const noexcept;
+
+        /**
+         * @brief Gets the entity index of each grouped slot.
+         * @return Pointer to the first grouped entity index
+         */
+        const size_t *entities() const noexcept;
+
+      private:
+        /**
+         * @brief Swaps two dense slots in every owned pool.
+         */
+        void swapAll(size_t lhs, size_t rhs) noexcept;
+
+        /** @brief Pools of each owned component */
+        std::tuple<SparseSet<Owned> *...> _pools = {};
+
+        /** @brief Generation of each entity index */
+        const std::vector<uint32_t> *_generations = nullptr;
+
+        /** @brief Number of packed entities */
+        size_t _size = 0;
+    };
+} // namespace Ecs
+
+#include "Group.tpp"
@@ -0,0 +1,114 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Group
+*/
+
+namespace Ecs
+{
+    template <typename... Owned>
+    Group<Owned...>::Group(std::tuple<SparseSet<Owned> *...> pools, const std::vector<uint32_t> &generations) noexcept
+        : _pools(pools), _generations(&generations)
+    {
+        refresh();
+    }
+
+    template <typename... Owned>
+    void Group<Owned...>::refresh() noexcept
+    {
+        _size = 0;
+        const std::vector<size_t> *smallest = nullptr;
+
+        ((smallest = (!smallest || std::get<SparseSet<Owned> *>(_pools)->size() < smallest->size())
+                ? &std::get<SparseSet<Owned> *>(_pools)->entities()
+                : smallest),
+            ...);
+        std::vector<size_t> candidates = *smallest;
+
+        for (size_t index : candidates)
+            if ((std::get<SparseSet<Owned> *>(_pools)->contains(index) && ...))
+                enter(index);
+    }
+
+    template <typename... Owned>
+    void Group<Owned...>::rebind(const std::vector<uint32_t> &generations) noexcept
+    {
+        _generations = &generations;
+    }
+
+    template <typename... Owned>
+    std::unique_ptr<IGroup> Group<Owned...>::clone(
+        const std::vector<std::shared_ptr<ISparseSet>> &pools, const std::vector<uint32_t> &generations) const
+    {
+        return std::make_unique<Group>(
+            std::make_tuple(static_cast<SparseSet<Owned> *>(pools[ComponentFamily::id<Owned>()].get())...),
+            generations);
+    }
+
+    template <typename... Owned>
+    Signature Group<Owned...>::mask() const noexcept
+    {
+        return signatureOf<Owned...>();
+    }
+
+    template <typename... Owned>
+    bool Group<Owned...>::contains(size_t index) const noexcept
+    {
+        return std::get<0>(_pools)->denseIndex(index) < _size;
+    }
+
+    template <typename... Owned>
+    void Group<Owned...>::enter(size_t index)
+    {
+        if (contains(index))
+            return;
+        (std::get<SparseSet<Owned> *>(_pools)->swapDense(
+             std::get<SparseSet<Owned> *>(_pools)->denseIndex(index), _size),
+            ...);
+        ++_size;
+    }
+
+    template <typename... Owned>
+    void Group<Owned...>::leave(size_t index)
+    {
+        if (!contains(index))
+            return;
+        (std::get<SparseSet<Owned> *>(_pools)->swapDense(
+             std::get<SparseSet<Owned> *>(_pools)->denseIndex(index), _size - 1),
+            ...);
+        --_size;
+    }
+
+    template <typename... Owned>
+    size_t Group<Owned...>::size() const noexcept
+    {
+        return _size;
+    }
+
+    template <typename... Owned>
+    template <typename Function>
+    void Group<Owned...>::each(Function fn) const
+    {
+        const size_t *indices = entities();
+        auto arrays = std::make_tuple(data<Owned>()...);
+
+        for (size_t i = 0; i < _size; ++i) {
+            (std::get<SparseSet<Owned> *>(_pools)->markDense(i), ...);
+            fn(Entity(indices[i], (*_generations)[indices[i]]), std::get<Owned *>(arrays)[i]...);
+        }
+    }
+
+    template <typename... Owned>
+    template <typename T>
+    T *Group<Owned...>::data() const noexcept
+    {
+        return std::get<SparseSet<T> *>(_pools)->components().data();
+    }
+
+    template <typename... Owned>
+    const size_t *Group<Owned...>::entities() const noexcept
+    {
+        return std::get<0>(_pools)->entities().data();
+    }
+}
@@ -0,0 +1,44 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** PoolStats
+*/
+
+#pragma once
+#include <cstddef>
+#include "ComponentFamily.hpp"
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @struct PoolStats
+     * @brief Memory footprint of one component pool.
+     *
+     * Byte counts cover the storage of the pool itself, not heap memory owned by
+     * the components (such as the string of a Drawable).
+     */
+    struct PoolStats {
+        ComponentId id = 0;         ///> Component type
+        const char *name = "";      ///> Implementation-defined type name (typeid)
+        size_t slots = 0;           ///> Entity indices covered by the allocated sparse storage
+        size_t live = 0;            ///> Number of stored components
+        size_t bytesReserved = 0;   ///> Bytes allocated by the pool
+        size_t bytesUsed = 0;       ///> Bytes needed by the live components
+
+        /**
+         * @brief Share of the reserved bytes that holds no live component.
+         * @return 0 for a tight pool, close to 1 for a mostly empty one
+         */
+        double fragmentation() const noexcept
+        {
+            if (bytesReserved == 0)
+                return 0.0;
+            return 1.0 - static_cast<double>(bytesUsed) / static_cast<double>(bytesReserved);
+        }
+    };
+} // namespace Ecs
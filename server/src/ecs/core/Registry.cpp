@@ -6,19 +6,260 @@
 */
 
 #include "Registry.hpp"
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <stdexcept>
+#include <utility>
 
 namespace Ecs
 {
-    Entity Registry::createEntity() noexcept
+    Registry::Registry(Registry &&other) noexcept
+        : _generations(std::move(other._generations)), _signatures(std::move(other._signatures)),
+          _freeList(std::move(other._freeList)), _pools(std::move(other._pools)), _groups(std::move(other._groups)),
+          _owners(std::exchange(other._owners, {})), _observers(std::move(other._observers))
     {
-        Entity entity(_entityCounter);
-        _entityCounter++;
-        return entity;
+        for (const auto &group : _groups)
+            group->rebind(_generations);
     }
 
-    void Registry::destroyEntity(Entity entity) noexcept
+    Registry &Registry::operator=(Registry &&other) noexcept
     {
-        for (auto &func : _destroyers)
-            func(*this, entity);
+        if (this == &other)
+            return *this;
+        _generations = std::move(other._generations);
+        _signatures = std::move(other._signatures);
+        _freeList = std::move(other._freeList);
+        _pools = std::move(other._pools);
+        _groups = std::move(other._groups);
+        _owners = std::exchange(other._owners, {});
+        _observers = std::move(other._observers);
+        for (const auto &group : _groups)
+            group->rebind(_generations);
+        return *this;
+    }
+
+    Entity Registry::createEntity()
+    {
+        if (!_freeList.empty()) {
+            size_t index = _freeList.back();
+            _freeList.pop_back();
+            return Entity(index, _generations[index]);
+        }
+        _generations.push_back(0);
+        _signatures.emplace_back();
+        return Entity(_generations.size() - 1, 0);
+    }
+
+    std::vector<Entity> Registry::createEntities(size_t count)
+    {
+        std::vector<Entity> entities;
+        size_t recycled = std::min(count, _freeList.size());
+
+        entities.reserve(count);
+        for (size_t i = 0; i < recycled; ++i) {
+            size_t index = _freeList.back();
+            _freeList.pop_back();
+            entities.emplace_back(index, _generations[index]);
+        }
+        size_t first = _generations.size();
+        _generations.resize(first + count - recycled, 0);
+        _signatures.resize(first + count - recycled);
+        for (size_t index = first; index < _generations.size(); ++index)
+            entities.emplace_back(index, 0);
+        return entities;
+    }
+
+    Registry::Registry(const Registry &parent, ForkTag)
+        : _generations(parent._generations), _signatures(parent._signatures), _freeList(parent._freeList),
+          _pools(parent._pools)
+    {
+        for (const auto &group : parent._groups) {
+            uint64_t bits = group->mask().to_ullong();
+
+            for (uint64_t rest = bits; rest; rest &= rest - 1)
+                mutablePool(static_cast<ComponentId>(std::countr_zero(rest)));
+            _groups.push_back(group->clone(_pools, _generations));
+            for (; bits; bits &= bits - 1)
+                _owners[static_cast<size_t>(std::countr_zero(bits))] = _groups.back().get();
+        }
+    }
+
+    Registry Registry::fork() const
+    {
+        return Registry(*this, ForkTag{});
+    }
+
+    ISparseSet *Registry::mutablePool(ComponentId id)
+    {
+        std::shared_ptr<ISparseSet> &pool = _pools[id];
+
+        if (pool && pool.use_count() > 1)
+            pool = pool->clone();
+        return pool.get();
+    }
+
+    void Registry::destroyEntity(Entity entity)
+    {
+        if (!isAlive(entity))
+            return;
+        uint64_t bits = _signatures[entity.index()].to_ullong();
+
+        while (bits) {
+            auto id = static_cast<ComponentId>(std::countr_zero(bits));
+            publish(&Observers::destroy, id, entity);
+            if (_owners[id])
+                _owners[id]->leave(entity.index());
+            mutablePool(id)->remove(entity.index());
+            bits &= bits - 1;
+        }
+        _signatures[entity.index()].reset();
+        _generations[entity.index()]++;
+        _freeList.push_back(entity.index());
+    }
+
+    void Registry::clearChanges()
+    {
+        for (ComponentId id = 0; id < _pools.size(); ++id)
+            if (_pools[id] && _pools[id]->isTracking())
+                mutablePool(id)->clearChanges();
+    }
+
+    Signature Registry::getSignature(Entity entity) const noexcept
+    {
+        if (!isAlive(entity))
+            return Signature();
+        return _signatures[entity.index()];
+    }
+
+    void Registry::attach(ComponentId id, size_t index)
+    {
+        Signature &signature = _signatures[index];
+
+        signature.set(id);
+        if (_owners[id] && (signature & _owners[id]->mask()) == _owners[id]->mask())
+            _owners[id]->enter(index);
+    }
+
+    void Registry::serialize(BinaryWriter &writer) const
+    {
+        writer.write(SNAPSHOT_MAGIC);
+        writer.write(static_cast<uint64_t>(_generations.size()));
+        writer.write(_generations.data(), _generations.size() * sizeof(uint32_t));
+        writer.write(static_cast<uint64_t>(_freeList.size()));
+        writer.write(_freeList.data(), _freeList.size() * sizeof(size_t));
+        writer.write(static_cast<uint64_t>(std::ranges::count_if(_pools, [](const auto &pool) {
+            return pool != nullptr;
+        })));
+        for (const auto &pool : _pools) {
+            if (!pool)
+                continue;
+            writer.write(pool->typeKey());
+            pool->serialize(writer);
+        }
+    }
+
+    void Registry::deserialize(BinaryReader &reader)
+    {
+        try {
+            restore(reader);
+        } catch (...) {
+            for (ComponentId id = 0; id < _pools.size(); ++id)
+                if (_pools[id])
+                    mutablePool(id)->clear();
+            _generations.clear();
+            _signatures.clear();
+            _freeList.clear();
+            for (auto &group : _groups)
+                group->refresh();
+            throw;
+        }
+    }
+
+    void Registry::restore(BinaryReader &reader)
+    {
+        if (reader.read<uint32_t>() != SNAPSHOT_MAGIC)
+            throw std::invalid_argument("{Registry::deserialize} Not a registry snapshot");
+        std::vector<uint32_t> generations = readBlock<uint32_t>(reader);
+        std::vector<size_t> freeList = readBlock<size_t>(reader);
+        std::vector<bool> restored(_pools.size(), false);
+        auto poolCount = reader.read<uint64_t>();
+
+        for (uint64_t i = 0; i < poolCount; ++i) {
+            auto key = reader.read<uint64_t>();
+            auto it = std::ranges::find_if(_pools, [key](const auto &pool) {
+                return pool && pool->typeKey() == key;
+            });
+
+            if (it == _pools.end())
+                throw std::invalid_argument("{Registry::deserialize} Component type is not registered");
+            auto id = static_cast<ComponentId>(it - _pools.begin());
+
+            mutablePool(id)->deserialize(reader, generations.size());
+            restored[id] = true;
+        }
+        if (std::ranges::any_of(freeList, [&generations](size_t index) { return index >= generations.size(); }))
+            throw std::invalid_argument("{Registry::deserialize} Free index out of range");
+        _generations = std::move(generations);
+        _freeList = std::move(freeList);
+        _signatures.assign(_generations.size(), Signature());
+        for (size_t id = 0; id < _pools.size(); ++id) {
+            if (!_pools[id])
+                continue;
+            if (!restored[id])
+                mutablePool(id)->clear();
+            size_t live = 0;
+
+            for (size_t index = 0; index < _generations.size(); ++index) {
+                if (_pools[id]->contains(index)) {
+                    _signatures[index].set(id);
+                    live++;
+                }
+            }
+            if (live != _pools[id]->size())
+                throw std::invalid_argument("{Registry::deserialize} Entity index out of range");
+        }
+        for (auto &group : _groups)
+            group->refresh();
+    }
+
+    std::vector<PoolStats> Registry::getMemoryStats() const
+    {
+        std::vector<PoolStats> stats;
+
+        for (ComponentId id = 0; id < _pools.size(); ++id) {
+            if (!_pools[id])
+                continue;
+            stats.push_back(_pools[id]->stats());
+            stats.back().id = id;
+        }
+        return stats;
+    }
+
+    void Registry::compact()
+    {
+        for (ComponentId id = 0; id < _pools.size(); ++id)
+            if (_pools[id])
+                mutablePool(id)->compact(_owners[id] ? _owners[id]->size() : 0);
+        std::sort(_freeList.begin(), _freeList.end(), std::greater<>());
+        _freeList.shrink_to_fit();
+    }
+
+    Registry::Observers &Registry::observers(ComponentId id)
+    {
+        if (id >= MAX_COMPONENTS)
+            throw std::length_error("{Registry::observers} Too many component types");
+        return _observers[id];
+    }
+
+    void Registry::publish(ComponentSignal Observers::*signal, ComponentId id, Entity entity)
+    {
+        if (!(_observers[id].*signal).empty())
+            (_observers[id].*signal).publish(*this, entity);
+    }
+
+    bool Registry::isAlive(Entity entity) const noexcept
+    {
+        return entity.index() < _generations.size() && _generations[entity.index()] == entity.generation();
     }
 } // namespace Ecs
@@ -6,14 +6,27 @@
 */
 
 #pragma once
-#include <any>
+#include <array>
 #include <cstddef>
-#include <functional>
-#include <typeindex>
+#include <cstdint>
+#include <memory>
+#include <span>
 #include <vector>
+#include "ComponentFamily.hpp"
+#include "BinaryReader.hpp"
+#include "BinaryWriter.hpp"
 #include "Entity.hpp"
-#include "SparseArray.hpp"
-#include <unordered_map>
+#include "Filters.hpp"
+#include "Group.hpp"
+#include "IGroup.hpp"
+#include "ISparseSet.hpp"
+#include "PoolStats.hpp"
+#include "Signal.hpp"
+#include "Signature.hpp"
+#include "SparseSet.hpp"
+#include "Storage.hpp"
+#include "ThreadPool.hpp"
+#include "View.hpp"
 
 /**
  * @namespace Ecs
@@ -30,46 +43,118 @@ namespace Ecs
      * - Registering component types
      * - Attaching and removing components to entities
      * - Iterating over entities owning specific components
+     *
+     * Component pools live in a flat vector indexed by ComponentFamily IDs,
+     * so finding the pool of a type is a single indexed load.
+     * Each entity also carries a Signature of the component types it owns, which
+     * keeps hasComponent and view filtering to bit tests.
+     *
+     * Components must be added and removed through the Registry (not directly on
+     * a pool) so signatures stay in sync.
      */
     class Registry {
       public:
+        /** @brief Signal published with the registry and the entity whose component changed */
+        using ComponentSignal = Signal<Registry &, Entity>;
+
+        /**
+         * @brief Constructs an empty registry.
+         */
+        Registry() = default;
+
+        /**
+         * @brief Takes over the entities, pools and groups of another registry.
+         *
+         * Groups are rebound to this registry, so a group taken before the move stays usable.
+         *
+         * @param other Registry left empty
+         */
+        Registry(Registry &&other) noexcept;
+
+        /**
+         * @brief Replaces the content of the registry with the one of another registry.
+         *
+         * Groups are rebound to this registry, so a group taken before the move stays usable.
+         *
+         * @param other Registry left empty
+         * @return This registry
+         */
+        Registry &operator=(Registry &&other) noexcept;
+
         /**
          * @brief Creates a new entity.
-         * @return A newly created Entity with a unique ID.
+         *
+         * Indices of destroyed entities are recycled first, with a bumped generation,
+         * so component storage stays bounded by the peak number of live entities.
+         *
+         * @return A newly created Entity with a unique (index, generation) pair.
+         */
+        Entity createEntity();
+
+        /**
+         * @brief Creates several entities at once.
+         *
+         * Recycled indices are used first, then the entity tables grow in a single step.
+         *
+         * @param count Number of entities to create
+         * @return The created entities
          */
-        Entity createEntity() noexcept;
+        std::vector<Entity> createEntities(size_t count);
 
         /**
          * @brief Destroys an entity and removes all of its components.
+         *
+         * Stale handles are ignored.
+         *
          * @param entity The entity to destroy.
+         * @throws std::logic_error if a pool shared with a fork holds a type that cannot be copied
          */
-        void destroyEntity(Entity entity) noexcept;
+        void destroyEntity(Entity entity);
+
+        /**
+         * @brief Checks if a handle refers to a live entity.
+         * @param entity The entity handle to check.
+         * @return true if the index is in use and the generation matches.
+         */
+        bool isAlive(Entity entity) const noexcept;
 
         /**
          * @brief Registers a new component type in the registry.
          *
          * If the component type is already registered, nothing happens.
+         * Empty types (tags) are stored in a TagSet, one bit per entity, and
+         * every other type in a SparseSet.
+         *
+         * Snapshots identify pools by typeKey<T>(), a hash of the type name. Types with
+         * the same name, such as anonymous-namespace types of different translation
+         * units, get the same key and cannot be registered in the same registry.
          *
          * @tparam T Component type
-         * @return A reference to the component SparseArray
+         * @return A reference to the component pool
+         * @throws std::length_error if more than MAX_COMPONENTS types are used by the process
+         * @throws std::logic_error if another registered type has the same typeKey<T>()
          */
         template <typename T>
-        SparseArray<T> &registerComponent();
+        Storage<T> &registerComponent();
 
         /**
-         * @brief Gets the SparseArray associated with a component type.
+         * @brief Gets the pool associated with a component type.
          *
          * The component must have been registered previously.
+         * The reference is invalidated by fork() (see there).
          *
          * @tparam T Component type
-         * @return A reference to the component SparseArray
+         * @return A reference to the component pool (TagSet for tags, SparseSet otherwise)
+         * @throws std::out_of_range if the component type is not registered
          */
         template <typename T>
-        SparseArray<T> &getComponents();
+        Storage<T> &getComponents();
 
         /**
          * @brief Constructs and assigns a component to an entity.
          *
+         * Nothing happens if the handle is stale.
+         *
          * @tparam T Component type
          * @tparam Args Constructor parameter pack
          * @param e Target entity
@@ -78,40 +163,398 @@ namespace Ecs
         template <typename T, typename... Args>
         void emplaceComponent(Entity e, Args &&...args);
 
+        /**
+         * @brief Assigns copies of the same components to several entities.
+         *
+         * Each pool reserves room for the whole batch once, then the components are
+         * written one after the other. Stale handles are skipped.
+         * Usage: `emplaceComponents(bullets, Position{x, y}, Velocity{8.f, 0.f})`
+         *
+         * @tparam T Component types
+         * @param entities Target entities
+         * @param components Value copied to every entity, one per component type
+         */
+        template <typename... T>
+        void emplaceComponents(std::span<const Entity> entities, const T &...components);
+
+        /**
+         * @brief Replaces the component of an entity, if it owns one.
+         *
+         * Publishes the onUpdate signal of T.
+         *
+         * @tparam T Component type
+         * @tparam Args Constructor parameter pack
+         * @param e Target entity
+         * @param args Arguments forwarded to the component constructor
+         */
+        template <typename T, typename... Args>
+        void replaceComponent(Entity e, Args &&...args);
+
         /**
          * @brief Checks if an entity owns a specific component.
          *
          * @tparam T Component type
          * @param e Target entity
-         * @return true if the entity has the component, false otherwise
+         * @return true if the entity is alive and has the component, false otherwise
          */
         template <typename T>
         bool hasComponent(Entity e);
 
+        /**
+         * @brief Removes a component from an entity, if present.
+         *
+         * @tparam T Component type
+         * @param e Target entity
+         */
+        template <typename T>
+        void removeComponent(Entity e);
+
+        /**
+         * @brief Signal published after an entity received a component of type T.
+         *
+         * Published by emplaceComponent and emplaceComponents when the entity did not
+         * own a T yet. Usage: `registry.onConstruct<Position>().connect<&Network::queueCreate>(network)`
+         * Handlers must not add or remove components of the entity being processed.
+         *
+         * @tparam T Component type
+         * @return The signal, valid as long as the Registry
+         */
+        template <typename T>
+        ComponentSignal &onConstruct();
+
+        /**
+         * @brief Signal published before an entity loses its component of type T.
+         *
+         * Published by removeComponent and destroyEntity, while the component can still be read.
+         *
+         * @tparam T Component type
+         * @return The signal, valid as long as the Registry
+         */
+        template <typename T>
+        ComponentSignal &onDestroy();
+
+        /**
+         * @brief Signal published after the component of type T of an entity was replaced.
+         *
+         * Published by replaceComponent, and by emplaceComponent(s) on an entity already owning a T.
+         * In-place writes through views or pools are not observed: use change tracking for those.
+         *
+         * @tparam T Component type
+         * @return The signal, valid as long as the Registry
+         */
+        template <typename T>
+        ComponentSignal &onUpdate();
+
+        /**
+         * @brief Enables or disables change tracking on a component pool.
+         *
+         * Tracked pools record the entities whose component was added, removed or
+         * accessed mutably (views, groups, non-const operator[]) during the tick, so
+         * snapshot builders only serialize what changed. Use `const T` in views that
+         * only read a tracked component.
+         *
+         * @tparam T Component type
+         * @param enabled true to record changes
+         */
+        template <typename T>
+        void trackChanges(bool enabled = true);
+
+        /**
+         * @brief Ends the change-tracking tick of every pool.
+         *
+         * Call it once per tick, after the snapshots were built.
+         */
+        void clearChanges();
+
+        /**
+         * @brief Gets the component signature of an entity.
+         * @param e Target entity
+         * @return The set of component types owned by the entity (empty if stale)
+         */
+        Signature getSignature(Entity e) const noexcept;
+
         /**
          * @brief Iterates over entities owning a set of components.
          *
          * Only entities with all specified components will be passed to the function.
+         * The loop walks the dense entity list of the smallest participating pool and
+         * probes the others, so its cost scales with the rarest component.
          *
          * @tparam Components List of required component types
          * @tparam Function Callable type
          * @param fn Function called for each valid entity
          *
          * Function signature must be:
-         * `void(Entity, Components&...)`
+         * `void(Entity, Components&...)`, with `T *` for `Optional<T>`
          */
         template <typename... Components, typename Function>
         void view(Function fn);
 
+        /**
+         * @brief Builds an iterable range over entities owning a set of components.
+         *
+         * Usage: `for (auto [entity, pos, vel] : registry.view<Position, Velocity>())`
+         *
+         * @tparam Components List of required component types
+         * @return A View driven by the smallest participating pool
+         */
+        template <typename... Components>
+        View<Components...> view();
+
+        /**
+         * @brief Builds an iterable range over entities owning a set of components but none of another.
+         *
+         * Excluded components are tested in the same signature compare as the required
+         * ones, so skipping them costs nothing per entity.
+         * Usage: `for (auto [entity, pos, vel] : registry.view<Position, Velocity>(exclude<Dead>))`
+         *
+         * @tparam Components List of required (or Optional) component types
+         * @tparam Excluded List of excluded component types
+         * @return A View driven by the smallest participating pool
+         */
+        template <typename... Components, typename... Excluded>
+        View<Components...> view(Exclude<Excluded...>);
+
+        /**
+         * @brief Iterates over entities owning a set of components but none of another.
+         *
+         * @tparam Components List of required (or Optional) component types
+         * @tparam Excluded List of excluded component types
+         * @tparam Function Callable type, with signature `void(Entity, Components&...)`
+         * @param fn Function called for each valid entity
+         */
+        template <typename... Components, typename... Excluded, typename Function>
+        void view(Exclude<Excluded...>, Function fn);
+
+        /**
+         * @brief Iterates over entities owning a set of components, on several threads.
+         *
+         * The driving pool of the view is split into chunks of grainSize entities that
+         * run on a work-stealing pool. fn is called concurrently: it may only touch the
+         * components it receives, and structural changes must go through one
+         * CommandBuffer per chunk or a thread-safe sink.
+         *
+         * Tracked pools stay consistent: while the chunks run, marking a component only
+         * stamps its slot, and the changed() list is rebuilt once every chunk is done.
+         *
+         * @tparam Components List of required component types
+         * @tparam Function Callable type, with signature `void(Entity, Components&...)`
+         * @param fn Function called for each valid entity
+         * @param grainSize Number of driving pool slots per chunk
+         * @param pool Thread pool running the chunks
+         */
+        template <typename... Components, typename Function>
+        void parallelView(Function fn, size_t grainSize = DEFAULT_GRAIN_SIZE,
+            Thread::ThreadPool &pool = Thread::ThreadPool::shared());
+
+        /** @brief Default number of entities per parallelView chunk */
+        static constexpr size_t DEFAULT_GRAIN_SIZE = 1024;
+
+        /**
+         * @brief Gets or creates the owning group of a set of components.
+         *
+         * The group takes ownership of the pools of its components and keeps the
+         * entities owning all of them packed at the front of each pool, so iterating
+         * the group is a linear walk over parallel arrays.
+         *
+         * A pool can only be owned by one group, and there are no partial (non-owning)
+         * groups: once Position and Velocity are grouped, Position cannot also be grouped
+         * with another component. Reserve groups for the hottest component set and use
+         * views everywhere else; library systems only use views, so they never claim a pool.
+         *
+         * @tparam Owned List of grouped component types (at least two)
+         * @return A reference to the group, valid as long as the Registry
+         * @throws std::logic_error if a component is already owned by another group
+         */
+        template <typename... Owned>
+        Group<Owned...> &group();
+
+        /**
+         * @brief Appends the whole state of the registry to a snapshot.
+         *
+         * Entity tables are copied as raw blocks, then every registered pool: its
+         * dense entity list and its components, as one raw block for trivially
+         * copyable types and through Serializer<T> for the others.
+         * Pools are keyed by typeKey<T>(), so the reader may have registered its
+         * types in another order. Change lists are not part of the snapshot.
+         *
+         * @param writer Snapshot buffer
+         * @throws std::logic_error if a registered type is neither trivially copyable nor has a Serializer
+         */
+        void serialize(BinaryWriter &writer) const;
+
+        /**
+         * @brief Replaces the state of the registry with a snapshot written by serialize().
+         *
+         * Every component type of the snapshot must be registered beforehand. Pools
+         * missing from the snapshot are emptied, signatures and groups are rebuilt.
+         * Handles issued before the snapshot was taken stay valid if their entity
+         * was alive at that time.
+         *
+         * @param reader Snapshot cursor
+         * @throws std::invalid_argument if the snapshot is malformed or holds an unregistered type
+         * @throws std::out_of_range if the snapshot is truncated
+         * On failure, the registry is left empty.
+         */
+        void deserialize(BinaryReader &reader);
+
+        /** @brief First bytes of a registry snapshot */
+        static constexpr uint32_t SNAPSHOT_MAGIC = 0x52545353;
+
+        /**
+         * @brief Measures the memory footprint of every registered pool.
+         *
+         * Usage: find the pool bloating a room by sorting on bytesReserved or fragmentation().
+         *
+         * @return One entry per registered component type, by increasing ComponentId
+         */
+        std::vector<PoolStats> getMemoryStats() const;
+
+        /**
+         * @brief Releases unused pool capacity, typically between two stages.
+         *
+         * Every pool is renumbered by entity index (groups keep their packed prefix)
+         * and shrunk to fit. The free list is sorted so the lowest indices are
+         * recycled first, which keeps the sparse pages of new entities dense.
+         */
+        void compact();
+
+        /**
+         * @brief Creates a copy-on-write clone of the registry, for rollback re-simulation.
+         *
+         * Pools are shared between the two registries and a pool is only copied the
+         * first time either side requests it for writing (registerComponent,
+         * getComponents, views over non-const components, adding or removing
+         * components). A copied pool still shares its sparse pages, which are in
+         * turn copied one by one when written. Views over `const T` never copy.
+         * Pools owned by a group are copied up front, along with the group.
+         * Observers are not copied: a fork publishes no component signal.
+         *
+         * A shared pool is copied into whichever registry writes to it first, so the
+         * parent may end up with a new pool too: every pool reference (getComponents(),
+         * registerComponent()) and every View taken from this registry before the fork is
+         * invalidated, and must be fetched again. Groups are not affected.
+         *
+         * @return The fork, independent from this registry
+         */
+        Registry fork() const;
+
       private:
-        /** @brief Counter used to assign unique IDs to entities */
-        size_t _entityCounter = 0;
+        /**
+         * @struct Observers
+         * @brief Signals of one component type.
+         */
+        struct Observers {
+            ComponentSignal construct = {}; ///> Published after a component is added
+            ComponentSignal destroy = {};   ///> Published before a component is removed
+            ComponentSignal update = {};    ///> Published after a component is replaced
+        };
+
+        /**
+         * @brief Gets the signals of a component type.
+         * @param id Component type
+         * @throws std::length_error if more than MAX_COMPONENTS types are used
+         */
+        Observers &observers(ComponentId id);
+
+        /**
+         * @brief Publishes a signal of a component type, if any handler is connected.
+         * @param signal Signal to publish
+         * @param id Component type
+         * @param entity Entity whose component changed
+         */
+        void publish(ComponentSignal Observers::*signal, ComponentId id, Entity entity);
+
+        /** @brief Selects the constructor used by fork() */
+        struct ForkTag {};
+
+        /**
+         * @brief Constructs a fork of a registry (see fork()).
+         */
+        Registry(const Registry &parent, ForkTag);
+
+        /**
+         * @brief Gets a pool for writing, copying it first if it is shared with a fork.
+         * @param id Component type
+         * @return The pool, or nullptr if the type is not registered
+         */
+        ISparseSet *mutablePool(ComponentId id);
+
+        /**
+         * @brief Gets the pool of a component type for reading, without copying a shared pool.
+         * @tparam T Component type
+         * @return Pointer to the pool, or nullptr if T is not registered
+         */
+        template <typename T>
+        Storage<T> *peekComponents() const noexcept;
+
+        /**
+         * @brief Gets the pool of a view component, only writable for non-const types.
+         * @tparam C View component (may be const or Optional)
+         */
+        template <typename C>
+        Storage<ComponentOf<C>> *viewPool();
+
+        /**
+         * @brief Defers the change list of a tracked view component written concurrently.
+         * @tparam C View component (const components and tags are left alone)
+         * @param deferred See SparseSet::deferChanges()
+         */
+        template <typename C>
+        void deferChanges(bool deferred) noexcept;
+
+        /**
+         * @brief Restores the entity tables and pools from a snapshot (see deserialize()).
+         */
+        void restore(BinaryReader &reader);
+
+        /**
+         * @brief Reads a length-prefixed raw array of a snapshot.
+         */
+        template <typename T>
+        static std::vector<T> readBlock(BinaryReader &reader);
+
+        /**
+         * @brief Gets the pool of a component type for writing, without checking registration.
+         * @tparam T Component type
+         * @return Pointer to the pool, or nullptr if T is not registered
+         */
+        template <typename T>
+        Storage<T> *findComponents();
+
+        /**
+         * @brief Assigns a copy of one component to several entities.
+         */
+        template <typename T>
+        void emplaceBatch(std::span<const Entity> entities, const T &component);
+
+        /**
+         * @brief Records a new component in an entity's signature and updates its owning group.
+         * @param id Component type just inserted in its pool
+         * @param index Entity index
+         */
+        void attach(ComponentId id, size_t index);
+
+        /** @brief Current generation of each entity index ever issued */
+        std::vector<uint32_t> _generations = {};
+
+        /** @brief Component signature of each entity index */
+        std::vector<Signature> _signatures = {};
+
+        /** @brief Indices of destroyed entities, ready to be recycled */
+        std::vector<size_t> _freeList = {};
+
+        /** @brief Component pools indexed by ComponentId (nullptr if not registered), shared with forks */
+        std::vector<std::shared_ptr<ISparseSet>> _pools = {};
+
+        /** @brief Owning groups created by group() */
+        std::vector<std::unique_ptr<IGroup>> _groups = {};
 
-        /** @brief Stores all registered component arrays indexed by type */
-        std::unordered_map<std::type_index, std::any> _entityToIndex = {};
+        /** @brief Group owning each component pool, indexed by ComponentId (nullptr if none) */
+        std::array<IGroup *, MAX_COMPONENTS> _owners = {};
 
-        /** @brief List of cleanup functions called during entity destruction */
-        std::vector<std::function<void(Registry &, Entity)>> _destroyers = {};
+        /** @brief Signals of each component type, indexed by ComponentId (fixed, so handlers can connect others) */
+        std::array<Observers, MAX_COMPONENTS> _observers = {};
     };
 } // namespace Ecs
 
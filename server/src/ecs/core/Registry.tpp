@@ -5,74 +5,245 @@
 ** Registry
 */
 
+#include <algorithm>
+#include <stdexcept>
+
 namespace Ecs
 {
     template <typename T>
-    SparseArray<T> &Registry::registerComponent()
+    Storage<T> &Registry::registerComponent()
     {
-        std::type_index typeIdx(typeid(T));
+        ComponentId id = ComponentFamily::id<T>();
 
-        if (_entityToIndex.find(typeIdx) == _entityToIndex.end()) {
-            _entityToIndex[typeIdx] = SparseArray<T>();
-            _destroyers.push_back([](Registry &reg, Entity ent) {
-                reg.getComponents<T>().remove(static_cast<size_t>(ent));
-            });
-        }
-        return std::any_cast<SparseArray<T> &>(_entityToIndex[typeIdx]);
+        if (id >= MAX_COMPONENTS)
+            throw std::length_error("{Registry::registerComponent} Too many component types");
+        if (id < _pools.size() && _pools[id])
+            return static_cast<Storage<T> &>(*mutablePool(id));
+        if (std::ranges::any_of(_pools, [](const auto &pool) { return pool && pool->typeKey() == typeKey<T>(); }))
+            throw std::logic_error("{Registry::registerComponent} Another registered type has the same type key");
+        if (id >= _pools.size())
+            _pools.resize(id + 1);
+        _pools[id] = std::make_shared<Storage<T>>();
+        return static_cast<Storage<T> &>(*_pools[id]);
+    }
+
+    template <typename T>
+    Storage<T> &Registry::getComponents()
+    {
+        Storage<T> *pool = findComponents<T>();
+
+        if (!pool)
+            throw std::out_of_range("{Registry::getComponents} Component type is not registered");
+        return *pool;
+    }
+
+    template <typename T>
+    Storage<T> *Registry::findComponents()
+    {
+        ComponentId id = ComponentFamily::id<T>();
+
+        if (id >= _pools.size())
+            return nullptr;
+        return static_cast<Storage<T> *>(mutablePool(id));
     }
 
     template <typename T>
-    SparseArray<T> &Registry::getComponents()
+    Storage<T> *Registry::peekComponents() const noexcept
+    {
+        ComponentId id = ComponentFamily::id<T>();
+
+        if (id >= _pools.size())
+            return nullptr;
+        return static_cast<Storage<T> *>(_pools[id].get());
+    }
+
+    template <typename C>
+    Storage<ComponentOf<C>> *Registry::viewPool()
     {
-        return std::any_cast<SparseArray<T> &>(
-            _entityToIndex.at(std::type_index(typeid(T))));
+        if constexpr (std::is_const_v<typename Unwrap<C>::type>)
+            return peekComponents<ComponentOf<C>>();
+        else
+            return findComponents<ComponentOf<C>>();
     }
 
     template <typename T, typename... Args>
     void Registry::emplaceComponent(Entity entity, Args &&...args)
     {
-        registerComponent<T>();
-        getComponents<T>().insert(
-            static_cast<size_t>(entity),
-            T(std::forward<Args>(args)...));
+        if (!isAlive(entity))
+            return;
+        ComponentId id = ComponentFamily::id<T>();
+        bool replaced = hasComponent<T>(entity);
+
+        registerComponent<T>().emplace(entity.index(), std::forward<Args>(args)...);
+        attach(id, entity.index());
+        publish(replaced ? &Observers::update : &Observers::construct, id, entity);
+    }
+
+    template <typename T, typename... Args>
+    void Registry::replaceComponent(Entity entity, Args &&...args)
+    {
+        if (!hasComponent<T>(entity))
+            return;
+        findComponents<T>()->emplace(entity.index(), std::forward<Args>(args)...);
+        publish(&Observers::update, ComponentFamily::id<T>(), entity);
+    }
+
+    template <typename... T>
+    void Registry::emplaceComponents(std::span<const Entity> entities, const T &...components)
+    {
+        (emplaceBatch<T>(entities, components), ...);
+    }
+
+    template <typename T>
+    void Registry::emplaceBatch(std::span<const Entity> entities, const T &component)
+    {
+        Storage<T> &pool = registerComponent<T>();
+        ComponentId id = ComponentFamily::id<T>();
+
+        pool.reserve(pool.size() + entities.size());
+        for (Entity entity : entities) {
+            if (!isAlive(entity))
+                continue;
+            bool replaced = _signatures[entity.index()].test(id);
+
+            pool.insert(entity.index(), component);
+            attach(id, entity.index());
+            publish(replaced ? &Observers::update : &Observers::construct, id, entity);
+        }
     }
 
     template <typename T>
     bool Registry::hasComponent(Entity entity)
     {
-        auto typeIdx = std::type_index(typeid(T));
-        if (!_entityToIndex.contains(typeIdx))
-            return false;
-        auto &arr = std::any_cast<SparseArray<T>&>(_entityToIndex[typeIdx]);
-        auto idx = static_cast<size_t>(entity);
-        if (idx >= arr.size())
-            return false;
-        return arr[idx].has_value();
+        ComponentId id = ComponentFamily::id<T>();
+
+        return isAlive(entity) && id < MAX_COMPONENTS && _signatures[entity.index()].test(id);
+    }
+
+    template <typename T>
+    void Registry::removeComponent(Entity entity)
+    {
+        if (!hasComponent<T>(entity))
+            return;
+        ComponentId id = ComponentFamily::id<T>();
+
+        publish(&Observers::destroy, id, entity);
+        if (_owners[id])
+            _owners[id]->leave(entity.index());
+        findComponents<T>()->remove(entity.index());
+        _signatures[entity.index()].reset(id);
     }
 
     template <typename... Components, typename Function>
     void Registry::view(Function fn)
     {
-        if ((!_entityToIndex.contains(std::type_index(typeid(Components))) || ...))
-            return;
-        auto arrays = std::forward_as_tuple(getComponents<Components>()...);
-        auto &first = std::get<0>(arrays);
-        size_t maxSize = first.size();
+        view<Components...>().each(fn);
+    }
 
-        for (size_t i = 0; i < maxSize; ++i) {
+    template <typename... Components>
+    View<Components...> Registry::view()
+    {
+        return view<Components...>(exclude<>);
+    }
 
-            bool ok = (
-                (i < std::get<SparseArray<Components>&>(arrays).size() &&
-                 std::get<SparseArray<Components>&>(arrays)[i].has_value()) && ...);
+    template <typename... Components, typename... Excluded>
+    View<Components...> Registry::view(Exclude<Excluded...>)
+    {
+        return View<Components...>(std::make_tuple(viewPool<Components>()...),
+            signatureOf<Excluded...>(), _generations, _signatures);
+    }
 
-            if (!ok)
-                continue;
+    template <typename... Components, typename... Excluded, typename Function>
+    void Registry::view(Exclude<Excluded...> filter, Function fn)
+    {
+        view<Components...>(filter).each(fn);
+    }
+
+    template <typename T>
+    Registry::ComponentSignal &Registry::onConstruct()
+    {
+        return observers(ComponentFamily::id<T>()).construct;
+    }
 
-            fn(
-                Entity(i),
-                *std::get<SparseArray<Components>&>(arrays)[i]...
-            );
+    template <typename T>
+    Registry::ComponentSignal &Registry::onDestroy()
+    {
+        return observers(ComponentFamily::id<T>()).destroy;
+    }
+
+    template <typename T>
+    Registry::ComponentSignal &Registry::onUpdate()
+    {
+        return observers(ComponentFamily::id<T>()).update;
+    }
+
+    template <typename T>
+    void Registry::trackChanges(bool enabled)
+    {
+        static_assert(!std::is_empty_v<T>, "Tag components are not change-tracked");
+        registerComponent<T>().setTracking(enabled);
+    }
+
+    template <typename... Components, typename Function>
+    void Registry::parallelView(Function fn, size_t grainSize, Thread::ThreadPool &pool)
+    {
+        View<Components...> range = view<Components...>();
+
+        (deferChanges<Components>(true), ...);
+        try {
+            pool.parallelFor(range.sizeHint(), grainSize, [&range, &fn](size_t begin, size_t end) {
+                range.each(begin, end, fn);
+            });
+        } catch (...) {
+            (deferChanges<Components>(false), ...);
+            throw;
+        }
+        (deferChanges<Components>(false), ...);
+    }
+
+    template <typename C>
+    void Registry::deferChanges(bool deferred) noexcept
+    {
+        using T = ComponentOf<C>;
+
+        if constexpr (!std::is_const_v<typename Unwrap<C>::type> && !std::is_empty_v<T>) {
+            Storage<T> *pool = peekComponents<T>();
+
+            if (pool && pool->isTracking())
+                pool->deferChanges(deferred);
         }
     }
 
+    template <typename... Owned>
+    Group<Owned...> &Registry::group()
+    {
+        static_assert(sizeof...(Owned) > 1, "A group needs at least two component types");
+        (registerComponent<Owned>(), ...);
+        Signature mask = signatureOf<Owned...>();
+        IGroup *owner = _owners[ComponentFamily::id<std::tuple_element_t<0, std::tuple<Owned...>>>()];
+
+        if (owner && owner->mask() == mask)
+            return static_cast<Group<Owned...> &>(*owner);
+        if ((_owners[ComponentFamily::id<Owned>()] || ...))
+            throw std::logic_error("{Registry::group} Component is already owned by another group");
+        auto group = std::make_unique<Group<Owned...>>(std::make_tuple(findComponents<Owned>()...), _generations);
+        Group<Owned...> &ref = *group;
+
+        ((_owners[ComponentFamily::id<Owned>()] = group.get()), ...);
+        _groups.push_back(std::move(group));
+        return ref;
+    }
+
+    template <typename T>
+    std::vector<T> Registry::readBlock(BinaryReader &reader)
+    {
+        auto count = reader.read<uint64_t>();
+
+        if (count > reader.remaining() / sizeof(T))
+            throw std::out_of_range("{Registry::deserialize} Snapshot is truncated");
+        std::vector<T> block(static_cast<size_t>(count));
+
+        reader.read(block.data(), block.size() * sizeof(T));
+        return block;
+    }
 }
@@ -0,0 +1,134 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Signal
+*/
+
+#pragma once
+#include <cstddef>
+#include <vector>
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @struct Delegate
+     * @brief Non-owning callable: a plain function pointer and the instance it is bound to.
+     *
+     * Unlike std::function, a delegate never allocates and calling it is a single
+     * indirect call.
+     *
+     * @tparam Args Parameters of the handler
+     */
+    template <typename... Args>
+    struct Delegate {
+        void (*function)(void *, Args...) = nullptr; ///> Thunk calling the handler
+        void *instance = nullptr;                    ///> Bound instance (nullptr for free functions)
+
+        bool operator==(const Delegate &other) const noexcept = default;
+    };
+
+    /**
+     * @class Signal
+     * @brief List of delegates called in connection order when the signal is published.
+     *
+     * Handlers are stored in one flat vector. A handler may connect or disconnect
+     * handlers of the signal being published: the changes are deferred, so handlers
+     * connected during a publish are first called by the next one, and handlers
+     * disconnected during a publish are not called anymore.
+     * Usage:
+     * @code
+     * signal.connect<&onSpawn>();
+     * signal.connect<&Network::queueCreate>(network);
+     * @endcode
+     *
+     * @tparam Args Parameters passed to the handlers
+     */
+    template <typename... Args>
+    class Signal {
+      public:
+        /**
+         * @brief Connects a free function `void(Args...)`.
+         * @tparam Function Function to call
+         */
+        template <auto Function>
+        void connect();
+
+        /**
+         * @brief Connects a member function `void(Args...)` of an instance.
+         * @tparam Method Member function to call
+         * @tparam Instance Type of the instance
+         * @param instance Object the method is called on, which must outlive the connection
+         */
+        template <auto Method, typename Instance>
+        void connect(Instance &instance);
+
+        /**
+         * @brief Disconnects a free function.
+         */
+        template <auto Function>
+        void disconnect() noexcept;
+
+        /**
+         * @brief Disconnects a member function of an instance.
+         */
+        template <auto Method, typename Instance>
+        void disconnect(Instance &instance) noexcept;
+
+        /**
+         * @brief Disconnects every handler bound to an instance.
+         * @param instance Bound instance
+         */
+        void disconnect(const void *instance) noexcept;
+
+        /**
+         * @brief Calls every handler.
+         * @param args Arguments passed to each handler
+         */
+        void publish(Args... args);
+
+        /**
+         * @brief Gets the number of connected handlers.
+         */
+        size_t size() const noexcept;
+
+        /**
+         * @brief Checks if no handler is connected.
+         */
+        bool empty() const noexcept;
+
+      private:
+        /**
+         * @brief Thunk calling a free function.
+         */
+        template <auto Function>
+        static void callFunction(void *, Args... args);
+
+        /**
+         * @brief Thunk calling a member function on the bound instance.
+         */
+        template <auto Method, typename Instance>
+        static void callMethod(void *instance, Args... args);
+
+        /**
+         * @brief Disconnects the handlers matching a predicate, or only clears them during a publish.
+         */
+        template <typename Predicate>
+        void remove(Predicate matches) noexcept;
+
+        /**
+         * @brief Ends a publish, erasing the handlers disconnected during the outermost one.
+         */
+        void endPublish() noexcept;
+
+        std::vector<Delegate<Args...>> _handlers = {}; ///> Connected handlers, in connection order
+        size_t _publishing = 0;                        ///> Depth of nested publish() calls
+        size_t _cleared = 0;                           ///> Handlers disconnected during a publish, still stored
+    };
+} // namespace Ecs
+
+#include "Signal.tpp"
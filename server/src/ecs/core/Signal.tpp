@@ -0,0 +1,125 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Signal
+*/
+
+#include <functional>
+#include <utility>
+
+namespace Ecs
+{
+    template <typename... Args>
+    template <auto Function>
+    void Signal<Args...>::connect()
+    {
+        _handlers.push_back({&Signal::callFunction<Function>, nullptr});
+    }
+
+    template <typename... Args>
+    template <auto Method, typename Instance>
+    void Signal<Args...>::connect(Instance &instance)
+    {
+        _handlers.push_back({&Signal::callMethod<Method, Instance>, &instance});
+    }
+
+    template <typename... Args>
+    template <auto Function>
+    void Signal<Args...>::disconnect() noexcept
+    {
+        remove([](const Delegate<Args...> &handler) {
+            return handler == Delegate<Args...>{&Signal::callFunction<Function>, nullptr};
+        });
+    }
+
+    template <typename... Args>
+    template <auto Method, typename Instance>
+    void Signal<Args...>::disconnect(Instance &instance) noexcept
+    {
+        remove([&instance](const Delegate<Args...> &handler) {
+            return handler == Delegate<Args...>{&Signal::callMethod<Method, Instance>, &instance};
+        });
+    }
+
+    template <typename... Args>
+    void Signal<Args...>::disconnect(const void *instance) noexcept
+    {
+        remove([instance](const Delegate<Args...> &handler) {
+            return handler.function && handler.instance == instance;
+        });
+    }
+
+    template <typename... Args>
+    template <typename Predicate>
+    void Signal<Args...>::remove(Predicate matches) noexcept
+    {
+        if (!_publishing) {
+            std::erase_if(_handlers, matches);
+            return;
+        }
+        for (Delegate<Args...> &handler : _handlers) {
+            if (matches(handler)) {
+                handler.function = nullptr;
+                _cleared++;
+            }
+        }
+    }
+
+    template <typename... Args>
+    void Signal<Args...>::endPublish() noexcept
+    {
+        if (--_publishing || !_cleared)
+            return;
+        std::erase_if(_handlers, [](const Delegate<Args...> &handler) {
+            return handler.function == nullptr;
+        });
+        _cleared = 0;
+    }
+
+    template <typename... Args>
+    template <auto Function>
+    void Signal<Args...>::callFunction(void *, Args... args)
+    {
+        std::invoke(Function, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    template <auto Method, typename Instance>
+    void Signal<Args...>::callMethod(void *instance, Args... args)
+    {
+        std::invoke(Method, *static_cast<Instance *>(instance), std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    void Signal<Args...>::publish(Args... args)
+    {
+        size_t count = _handlers.size();
+
+        _publishing++;
+        try {
+            for (size_t i = 0; i < count; ++i) {
+                Delegate<Args...> handler = _handlers[i];
+
+                if (handler.function)
+                    handler.function(handler.instance, args...);
+            }
+        } catch (...) {
+            endPublish();
+            throw;
+        }
+        endPublish();
+    }
+
+    template <typename... Args>
+    size_t Signal<Args...>::size() const noexcept
+    {
+        return _handlers.size() - _cleared;
+    }
+
+    template <typename... Args>
+    bool Signal<Args...>::empty() const noexcept
+    {
+        return size() == 0;
+    }
+}
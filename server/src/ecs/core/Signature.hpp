@@ -0,0 +1,46 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Signature
+*/
+
+#pragma once
+#include <bitset>
+#include <cstddef>
+#include <stdexcept>
+#include "ComponentFamily.hpp"
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /** @brief Maximum number of component types used by the process, across every Registry */
+    constexpr size_t MAX_COMPONENTS = 64;
+
+    /**
+     * @brief Bitmask of the component types owned by an entity.
+     *
+     * Bit N is set when the entity owns the component whose ComponentId is N.
+     */
+    using Signature = std::bitset<MAX_COMPONENTS>;
+
+    /**
+     * @brief Builds the signature of a set of component types.
+     * @tparam Components Component types
+     * @return A signature with the bit of each component type set
+     * @throws std::length_error if a component type got an ID past MAX_COMPONENTS
+     */
+    template <typename... Components>
+    Signature signatureOf()
+    {
+        Signature signature;
+
+        if (((ComponentFamily::id<Components>() >= MAX_COMPONENTS) || ...))
+            throw std::length_error("{signatureOf} Too many component types");
+        (signature.set(ComponentFamily::id<Components>()), ...);
+        return signature;
+    }
+} // namespace Ecs
@@ -7,6 +7,7 @@
 
 #pragma once
 #include <optional>
+#include <utility>
 #include <vector>
 
 /**
@@ -43,6 +44,26 @@ namespace Ecs
          */
         void insert(size_t index, const Component &component) noexcept;
 
+        /**
+         * @brief Inserts or replaces a component at a specific index, moving it into the slot.
+         * @param index Entity index
+         * @param component Component to insert
+         */
+        void insert(size_t index, Component &&component) noexcept;
+
+        /**
+         * @brief Constructs a component directly in the slot of a specific index.
+         *
+         * Any component already stored at this index is destroyed first.
+         *
+         * @tparam Args Constructor parameter pack
+         * @param index Entity index
+         * @param args Arguments forwarded to the component constructor
+         * @return Reference to the stored component
+         */
+        template <typename... Args>
+        Component &emplace(size_t index, Args &&...args);
+
         /**
          * @brief Removes the component at a specific index.
          * @param index Entity index
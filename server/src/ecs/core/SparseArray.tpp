@@ -15,6 +15,23 @@ namespace Ecs
         _components[index] = component;
     }
 
+    template <typename Component>
+    void SparseArray<Component>::insert(size_t index, Component &&component) noexcept
+    {
+        if (index >= _components.size())
+            _components.resize(index + 1);
+        _components[index] = std::move(component);
+    }
+
+    template <typename Component>
+    template <typename... Args>
+    Component &SparseArray<Component>::emplace(size_t index, Args &&...args)
+    {
+        if (index >= _components.size())
+            _components.resize(index + 1);
+        return _components[index].emplace(std::forward<Args>(args)...);
+    }
+
     template <typename Component>
     void SparseArray<Component>::remove(size_t index) noexcept
     {
@@ -0,0 +1,344 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** SparseSet
+*/
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "ISparseSet.hpp"
+#include "Serializer.hpp"
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @class SparseSet
+     * @brief Dense storage mode for components, indexed by entity index.
+     *
+     * Unlike SparseArray, components are not stored at their entity index.
+     * The set keeps three arrays:
+     * - a sparse table mapping an entity index to a dense position, split in fixed-size
+     *   pages allocated on demand and released once empty, so a component owned by a
+     *   few entities with high indices stays cheap; pages are shared copy-on-write
+     *   between a set and its clones,
+     * - a densely packed array of components,
+     * - a dense list of the entity index owning each component.
+     *
+     * Iterating the dense arrays only touches live components, in contiguous memory.
+     * Removal swaps the last component into the freed slot, so the dense order is not stable.
+     *
+     * When change tracking is enabled, each dense slot keeps the tick of its last change.
+     * A slot changes on insert and on mutable access (non-const operator[] or markChanged),
+     * and the set lists the entities changed, added and removed since the last clearChanges().
+     *
+     * @tparam Component Type of the stored component
+     */
+    template <typename Component>
+    class SparseSet : public ISparseSet {
+      public:
+        /** @brief Value stored in the sparse table for indices without a component */
+        static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+        /** @brief Number of entity indices covered by one sparse page */
+        static constexpr size_t PAGE_SIZE = 1024;
+
+        /**
+         * @brief Default constructor
+         */
+        SparseSet() = default;
+
+        /**
+         * @brief Default destructor
+         */
+        ~SparseSet() override = default;
+
+        /**
+         * @brief Inserts or replaces the component of an entity.
+         * @param index Entity index
+         * @param component Component to insert
+         */
+        void insert(size_t index, const Component &component);
+
+        /**
+         * @brief Inserts or replaces the component of an entity, moving it into storage.
+         * @param index Entity index
+         * @param component Component to insert
+         */
+        void insert(size_t index, Component &&component);
+
+        /**
+         * @brief Constructs the component of an entity directly in the dense array.
+         *
+         * If the entity already has one, it is assigned a component built from args
+         * (or args itself, when it is a single Component).
+         *
+         * @tparam Args Constructor parameter pack
+         * @param index Entity index
+         * @param args Arguments forwarded to the component constructor
+         * @return Reference to the stored component
+         */
+        template <typename... Args>
+        Component &emplace(size_t index, Args &&...args);
+
+        /**
+         * @brief Removes the component of an entity, if any.
+         *
+         * The last dense component is moved into the freed slot. Sparse pages shared
+         * with a fork are copied before anything is modified, so the set is left
+         * unchanged if that copy throws.
+         *
+         * @param index Entity index
+         * @throws std::bad_alloc if a shared sparse page cannot be copied
+         */
+        void remove(size_t index) override;
+
+        /**
+         * @brief Checks if an entity owns a component in this set.
+         * @param index Entity index
+         * @return true if a component is stored for this index
+         */
+        bool contains(size_t index) const noexcept override;
+
+        /**
+         * @brief Accesses the component of an entity.
+         * @param index Entity index
+         * @return Pointer to the component, or nullptr if the entity has none
+         */
+        Component *operator[](size_t index) noexcept;
+
+        /**
+         * @brief Accesses the component of an entity without marking it as changed.
+         * @param index Entity index
+         * @return Pointer to the component, or nullptr if the entity has none
+         */
+        const Component *operator[](size_t index) const noexcept;
+
+        /**
+         * @brief Gets the dense position of an entity's component.
+         * @param index Entity index
+         * @return Position in the dense arrays, or npos if absent
+         */
+        size_t denseIndex(size_t index) const noexcept;
+
+        /**
+         * @brief Swaps two dense slots, keeping the sparse table consistent.
+         * @param lhs First dense position
+         * @param rhs Second dense position
+         * @throws std::bad_alloc if a shared sparse page cannot be copied (the set is left unchanged)
+         */
+        void swapDense(size_t lhs, size_t rhs);
+
+        /**
+         * @brief Gets the number of stored components.
+         * @return Number of live components
+         */
+        size_t size() const noexcept override;
+
+        /**
+         * @brief Gets the number of allocated sparse pages.
+         */
+        size_t pageCount() const noexcept;
+
+        /**
+         * @brief Checks if the set stores no component.
+         * @return true if the set is empty
+         */
+        bool empty() const noexcept;
+
+        /**
+         * @brief Reserves room in the dense arrays.
+         * @param capacity Number of components to hold without reallocating
+         */
+        void reserve(size_t capacity);
+
+        /**
+         * @brief Removes every component from the set.
+         */
+        void clear() noexcept override;
+
+        /**
+         * @brief Densely packed components, in dense order.
+         * @return Reference to the component array
+         */
+        std::vector<Component> &components() noexcept;
+
+        /**
+         * @brief Entity index owning each dense component.
+         * @return Reference to the dense entity list
+         */
+        const std::vector<size_t> &entities() const noexcept;
+
+        /**
+         * @brief Iterators over the densely packed components.
+         */
+        typename std::vector<Component>::iterator begin() noexcept;
+
+        typename std::vector<Component>::iterator end() noexcept;
+
+        /**
+         * @brief Enables or disables change tracking. Pending change lists are dropped.
+         * @param enabled true to record changes
+         */
+        void setTracking(bool enabled) noexcept;
+
+        /**
+         * @brief Checks if change tracking is enabled.
+         */
+        bool isTracking() const noexcept override;
+
+        /**
+         * @brief Defers the updates of changed() while several threads mark distinct slots.
+         *
+         * While deferred, a marked slot only gets its stamp. Ending the deferral rebuilds
+         * changed() from the stamps, in dense order.
+         *
+         * @param deferred true to start deferring, false to rebuild changed()
+         */
+        void deferChanges(bool deferred) noexcept;
+
+        /**
+         * @brief Marks the component of an entity as changed in the current tick.
+         * @param index Entity index
+         */
+        void markChanged(size_t index) noexcept;
+
+        /**
+         * @brief Marks a dense slot as changed in the current tick.
+         * @param pos Dense position
+         */
+        void markDense(size_t pos) noexcept;
+
+        /**
+         * @brief Checks if the component of an entity changed in the current tick.
+         * @param index Entity index
+         */
+        bool isChanged(size_t index) const noexcept;
+
+        /**
+         * @brief Entities whose component changed in the current tick, without duplicates.
+         *
+         * May list entities removed afterwards: check contains() before reading them.
+         */
+        const std::vector<size_t> &changed() const noexcept;
+
+        /**
+         * @brief Entities that received the component in the current tick.
+         */
+        const std::vector<size_t> &added() const noexcept;
+
+        /**
+         * @brief Entities that lost the component in the current tick.
+         */
+        const std::vector<size_t> &removed() const noexcept;
+
+        /**
+         * @brief Starts a new tick: every change list is emptied.
+         */
+        void clearChanges() noexcept override;
+
+        /**
+         * @brief Copies the set. Sparse pages stay shared until one of the copies writes to them.
+         * @return The new set
+         * @throws std::logic_error if Component is not copy constructible
+         */
+        std::unique_ptr<ISparseSet> clone() const override;
+
+        /**
+         * @brief Measures the memory footprint of the set.
+         */
+        PoolStats stats() const noexcept override;
+
+        /**
+         * @brief Sorts the dense arrays by entity index and releases unused capacity.
+         *
+         * Slots [0, prefix) and [prefix, size()) are sorted separately.
+         *
+         * @param prefix Number of leading slots packed by a group (0 if none)
+         */
+        void compact(size_t prefix) override;
+
+        /**
+         * @brief Gets the snapshot key of the stored component type.
+         */
+        uint64_t typeKey() const noexcept override;
+
+        /**
+         * @brief Appends the content of the set to a snapshot.
+         * @param writer Snapshot buffer
+         */
+        void serialize(BinaryWriter &writer) const override;
+
+        /**
+         * @brief Replaces the content of the set with the one read from a snapshot.
+         *
+         * Pending change lists are dropped. The set is left untouched if the snapshot is invalid.
+         *
+         * @param reader Snapshot cursor
+         * @param indexLimit Number of entity indices of the snapshot
+         * @throws std::out_of_range if the snapshot is truncated
+         * @throws std::invalid_argument if an entity index is listed twice or is not below indexLimit
+         * @throws std::logic_error if Component is not default constructible
+         */
+        void deserialize(BinaryReader &reader, size_t indexLimit) override;
+
+      private:
+        /** @brief One page of the sparse table */
+        using Page = std::array<size_t, PAGE_SIZE>;
+
+        /**
+         * @brief Gets the sparse entry of an entity index for writing.
+         *
+         * Allocates the page if needed, or copies it if it is shared with a clone.
+         *
+         * @param index Entity index
+         */
+        size_t &sparseSlot(size_t index);
+
+        /** @brief Sparse table pages, mapping an entity index to its dense position (npos if absent) */
+        std::vector<std::shared_ptr<Page>> _pages = {};
+
+        /** @brief Number of live entries in each sparse page */
+        std::vector<size_t> _pageCounts = {};
+
+        /** @brief Densely packed components */
+        std::vector<Component> _dense = {};
+
+        /** @brief Entity index owning each dense component */
+        std::vector<size_t> _entities = {};
+
+        /** @brief true if changes are recorded */
+        bool _tracking = false;
+
+        /** @brief true while changed() is not updated by markDense() (see deferChanges()) */
+        bool _deferred = false;
+
+        /** @brief Current tick, bumped by clearChanges() */
+        uint32_t _tick = 1;
+
+        /** @brief Tick of the last change of each dense slot (only when tracking) */
+        std::vector<uint32_t> _stamps = {};
+
+        /** @brief Entities changed in the current tick */
+        std::vector<size_t> _changed = {};
+
+        /** @brief Entities that received the component in the current tick */
+        std::vector<size_t> _added = {};
+
+        /** @brief Entities that lost the component in the current tick */
+        std::vector<size_t> _removed = {};
+    };
+} // namespace Ecs
+
+#include "SparseSet.tpp"
@@ -0,0 +1,415 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** SparseSet
+*/
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <typeinfo>
+
+namespace Ecs
+{
+    template <typename Component>
+    void SparseSet<Component>::insert(size_t index, const Component &component)
+    {
+        emplace(index, component);
+    }
+
+    template <typename Component>
+    void SparseSet<Component>::insert(size_t index, Component &&component)
+    {
+        emplace(index, std::move(component));
+    }
+
+    template <typename Component>
+    template <typename... Args>
+    Component &SparseSet<Component>::emplace(size_t index, Args &&...args)
+    {
+        size_t pos = denseIndex(index);
+
+        if (pos != npos) {
+            if constexpr (sizeof...(Args) == 1 && (std::is_same_v<std::remove_cvref_t<Args>, Component> && ...))
+                _dense[pos] = (std::forward<Args>(args), ...);
+            else
+                _dense[pos] = Component(std::forward<Args>(args)...);
+            markDense(pos);
+            return _dense[pos];
+        }
+        size_t &slot = sparseSlot(index);
+
+        _dense.emplace_back(std::forward<Args>(args)...);
+        slot = _dense.size() - 1;
+        _pageCounts[index / PAGE_SIZE]++;
+        _entities.push_back(index);
+        if (_tracking) {
+            _stamps.push_back(0);
+            markDense(_dense.size() - 1);
+            _added.push_back(index);
+        }
+        return _dense.back();
+    }
+
+    template <typename Component>
+    void SparseSet<Component>::remove(size_t index)
+    {
+        size_t pos = denseIndex(index);
+
+        if (pos == npos)
+            return;
+        size_t last = _dense.size() - 1;
+        size_t &moved = sparseSlot(_entities[last]);
+        size_t &slot = sparseSlot(index);
+
+        if (_tracking)
+            _removed.push_back(index);
+        if (pos != last) {
+            _dense[pos] = std::move(_dense[last]);
+            _entities[pos] = _entities[last];
+            moved = pos;
+        }
+        slot = npos;
+        _dense.pop_back();
+        _entities.pop_back();
+        if (--_pageCounts[index / PAGE_SIZE] == 0)
+            _pages[index / PAGE_SIZE].reset();
+        if (_tracking) {
+            _stamps[pos] = _stamps[last];
+            _stamps.pop_back();
+        }
+    }
+
+    template <typename Component>
+    bool SparseSet<Component>::contains(size_t index) const noexcept
+    {
+        return denseIndex(index) != npos;
+    }
+
+    template <typename Component>
+    Component *SparseSet<Component>::operator[](size_t index) noexcept
+    {
+        size_t pos = denseIndex(index);
+
+        if (pos == npos)
+            return nullptr;
+        markDense(pos);
+        return &_dense[pos];
+    }
+
+    template <typename Component>
+    const Component *SparseSet<Component>::operator[](size_t index) const noexcept
+    {
+        size_t pos = denseIndex(index);
+
+        return pos == npos ? nullptr : &_dense[pos];
+    }
+
+    template <typename Component>
+    size_t SparseSet<Component>::denseIndex(size_t index) const noexcept
+    {
+        size_t page = index / PAGE_SIZE;
+
+        if (page >= _pages.size() || !_pages[page])
+            return npos;
+        return (*_pages[page])[index % PAGE_SIZE];
+    }
+
+    template <typename Component>
+    size_t &SparseSet<Component>::sparseSlot(size_t index)
+    {
+        size_t page = index / PAGE_SIZE;
+
+        if (page >= _pages.size()) {
+            _pages.resize(page + 1);
+            _pageCounts.resize(page + 1, 0);
+        }
+        if (!_pages[page]) {
+            _pages[page] = std::make_shared<Page>();
+            _pages[page]->fill(npos);
+        } else if (_pages[page].use_count() > 1) {
+            _pages[page] = std::make_shared<Page>(*_pages[page]);
+        }
+        return (*_pages[page])[index % PAGE_SIZE];
+    }
+
+    template <typename Component>
+    void SparseSet<Component>::swapDense(size_t lhs, size_t rhs)
+    {
+        if (lhs == rhs)
+            return;
+        size_t &lhsSlot = sparseSlot(_entities[lhs]);
+        size_t &rhsSlot = sparseSlot(_entities[rhs]);
+
+        std::swap(_dense[lhs], _dense[rhs]);
+        std::swap(_entities[lhs], _entities[rhs]);
+        if (_tracking)
+            std::swap(_stamps[lhs], _stamps[rhs]);
+        lhsSlot = rhs;
+        rhsSlot = lhs;
+    }
+
+    template <typename Component>
+    size_t SparseSet<Component>::size() const noexcept
+    {
+        return _dense.size();
+    }
+
+    template <typename Component>
+    size_t SparseSet<Component>::pageCount() const noexcept
+    {
+        return static_cast<size_t>(std::count_if(_pages.begin(), _pages.end(), [](const auto &page) {
+            return page != nullptr;
+        }));
+    }
+
+    template <typename Component>
+    bool SparseSet<Component>::empty() const noexcept
+    {
+        return _dense.empty();
+    }
+
+    template <typename Component>
+    void SparseSet<Component>::reserve(size_t capacity)
+    {
+        _dense.reserve(capacity);
+        _entities.reserve(capacity);
+        if (_tracking)
+            _stamps.reserve(capacity);
+    }
+
+    template <typename Component>
+    void SparseSet<Component>::clear() noexcept
+    {
+        if (_tracking)
+            _removed.insert(_removed.end(), _entities.begin(), _entities.end());
+        _pages.clear();
+        _pageCounts.clear();
+        _dense.clear();
+        _entities.clear();
+        _stamps.clear();
+    }
+
+    template <typename Component>
+    std::vector<Component> &SparseSet<Component>::components() noexcept
+    {
+        return _dense;
+    }
+
+    template <typename Component>
+    const std::vector<size_t> &SparseSet<Component>::entities() const noexcept
+    {
+        return _entities;
+    }
+
+    template <typename Component>
+    typename std::vector<Component>::iterator SparseSet<Component>::begin() noexcept
+    {
+        return _dense.begin();
+    }
+
+    template <typename Component>
+    typename std::vector<Component>::iterator SparseSet<Component>::end() noexcept
+    {
+        return _dense.end();
+    }
+
+    template <typename Component>
+    void SparseSet<Component>::setTracking(bool enabled) noexcept
+    {
+        _tracking = enabled;
+        _stamps.assign(enabled ? _dense.size() : 0, 0);
+        _changed.clear();
+        _added.clear();
+        _removed.clear();
+    }
+
+    template <typename Component>
+    bool SparseSet<Component>::isTracking() const noexcept
+    {
+        return _tracking;
+    }
+
+    template <typename Component>
+    void SparseSet<Component>::deferChanges(bool deferred) noexcept
+    {
+        if (_deferred && !deferred) {
+            _changed.clear();
+            for (size_t pos = 0; pos < _stamps.size(); ++pos)
+                if (_stamps[pos] == _tick)
+                    _changed.push_back(_entities[pos]);
+        }
+        _deferred = deferred;
+    }
+
+    template <typename Component>
+    void SparseSet<Component>::markChanged(size_t index) noexcept
+    {
+        size_t pos = denseIndex(index);
+
+        if (pos != npos)
+            markDense(pos);
+    }
+
+    template <typename Component>
+    void SparseSet<Component>::markDense(size_t pos) noexcept
+    {
+        if (!_tracking || _stamps[pos] == _tick)
+            return;
+        _stamps[pos] = _tick;
+        if (!_deferred)
+            _changed.push_back(_entities[pos]);
+    }
+
+    template <typename Component>
+    bool SparseSet<Component>::isChanged(size_t index) const noexcept
+    {
+        size_t pos = denseIndex(index);
+
+        return _tracking && pos != npos && _stamps[pos] == _tick;
+    }
+
+    template <typename Component>
+    const std::vector<size_t> &SparseSet<Component>::changed() const noexcept
+    {
+        return _changed;
+    }
+
+    template <typename Component>
+    const std::vector<size_t> &SparseSet<Component>::added() const noexcept
+    {
+        return _added;
+    }
+
+    template <typename Component>
+    const std::vector<size_t> &SparseSet<Component>::removed() const noexcept
+    {
+        return _removed;
+    }
+
+    template <typename Component>
+    void SparseSet<Component>::clearChanges() noexcept
+    {
+        _tick++;
+        _changed.clear();
+        _added.clear();
+        _removed.clear();
+    }
+
+    template <typename Component>
+    std::unique_ptr<ISparseSet> SparseSet<Component>::clone() const
+    {
+        if constexpr (std::is_copy_constructible_v<Component>)
+            return std::make_unique<SparseSet>(*this);
+        else
+            throw std::logic_error("{SparseSet::clone} Component type is not copy constructible");
+    }
+
+    template <typename Component>
+    PoolStats SparseSet<Component>::stats() const noexcept
+    {
+        PoolStats stats;
+        size_t pages = pageCount();
+        size_t stamp = _tracking ? sizeof(uint32_t) : 0;
+
+        stats.name = typeid(Component).name();
+        stats.slots = pages * PAGE_SIZE;
+        stats.live = _dense.size();
+        stats.bytesReserved = _dense.capacity() * sizeof(Component) + _entities.capacity() * sizeof(size_t)
+            + _stamps.capacity() * sizeof(uint32_t) + pages * sizeof(Page)
+            + _pages.capacity() * sizeof(std::shared_ptr<Page>) + _pageCounts.capacity() * sizeof(size_t);
+        stats.bytesUsed = _dense.size() * (sizeof(Component) + 2 * sizeof(size_t) + stamp);
+        return stats;
+    }
+
+    template <typename Component>
+    void SparseSet<Component>::compact(size_t prefix)
+    {
+        std::vector<size_t> order(_dense.size());
+        auto byEntity = [this](size_t lhs, size_t rhs) {
+            return _entities[lhs] < _entities[rhs];
+        };
+
+        prefix = std::min(prefix, order.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(prefix), byEntity);
+        std::sort(order.begin() + static_cast<std::ptrdiff_t>(prefix), order.end(), byEntity);
+        std::vector<Component> dense;
+        std::vector<size_t> entities;
+        std::vector<uint32_t> stamps;
+
+        dense.reserve(order.size());
+        entities.reserve(order.size());
+        stamps.reserve(_tracking ? order.size() : 0);
+        for (size_t pos : order) {
+            dense.push_back(std::move(_dense[pos]));
+            entities.push_back(_entities[pos]);
+            if (_tracking)
+                stamps.push_back(_stamps[pos]);
+        }
+        _dense.swap(dense);
+        _entities.swap(entities);
+        _stamps.swap(stamps);
+        for (size_t pos = 0; pos < _entities.size(); ++pos)
+            if (denseIndex(_entities[pos]) != pos)
+                sparseSlot(_entities[pos]) = pos;
+        while (!_pages.empty() && !_pages.back()) {
+            _pages.pop_back();
+            _pageCounts.pop_back();
+        }
+        _pages.shrink_to_fit();
+        _pageCounts.shrink_to_fit();
+        _changed.shrink_to_fit();
+        _added.shrink_to_fit();
+        _removed.shrink_to_fit();
+    }
+
+    template <typename Component>
+    uint64_t SparseSet<Component>::typeKey() const noexcept
+    {
+        return Ecs::typeKey<Component>();
+    }
+
+    template <typename Component>
+    void SparseSet<Component>::serialize(BinaryWriter &writer) const
+    {
+        writer.write(static_cast<uint64_t>(_dense.size()));
+        writer.write(_entities.data(), _entities.size() * sizeof(size_t));
+        writeComponents(writer, _dense.data(), _dense.size());
+    }
+
+    template <typename Component>
+    void SparseSet<Component>::deserialize(BinaryReader &reader, size_t indexLimit)
+    {
+        if constexpr (!std::is_default_constructible_v<Component>)
+            throw std::logic_error("{SparseSet::deserialize} Component type is not default constructible");
+        auto count = reader.read<uint64_t>();
+
+        if (count > reader.remaining() / sizeof(size_t))
+            throw std::out_of_range("{SparseSet::deserialize} Snapshot is truncated");
+        SparseSet restored;
+
+        restored._entities.resize(static_cast<size_t>(count));
+        reader.read(restored._entities.data(), restored._entities.size() * sizeof(size_t));
+        if (std::ranges::any_of(restored._entities, [indexLimit](size_t index) { return index >= indexLimit; }))
+            throw std::invalid_argument("{SparseSet::deserialize} Entity index out of range");
+        if constexpr (std::is_default_constructible_v<Component>)
+            restored._dense.resize(restored._entities.size());
+        readComponents(reader, restored._dense.data(), restored._dense.size());
+        for (size_t pos = 0; pos < restored._entities.size(); ++pos) {
+            size_t index = restored._entities[pos];
+            size_t &slot = restored.sparseSlot(index);
+
+            if (slot != npos)
+                throw std::invalid_argument("{SparseSet::deserialize} Entity is listed twice");
+            slot = pos;
+            restored._pageCounts[index / PAGE_SIZE]++;
+        }
+        _pages.swap(restored._pages);
+        _pageCounts.swap(restored._pageCounts);
+        _dense.swap(restored._dense);
+        _entities.swap(restored._entities);
+        setTracking(_tracking);
+    }
+}
@@ -0,0 +1,25 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Storage
+*/
+
+#pragma once
+#include <type_traits>
+#include "SparseSet.hpp"
+#include "TagSet.hpp"
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @brief Pool type storing a component: a TagSet for empty types, a SparseSet otherwise.
+     * @tparam T Component type
+     */
+    template <typename T>
+    using Storage = std::conditional_t<std::is_empty_v<T>, TagSet<T>, SparseSet<T>>;
+} // namespace Ecs
@@ -0,0 +1,186 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** TagSet
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include "ISparseSet.hpp"
+#include "Serializer.hpp"
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @class TagSet
+     * @brief Storage mode for empty components (tags), one bit per entity index.
+     *
+     * A tag carries no data, so the set only records which entity indices own it
+     * in a dynamic bitset of 64-bit words. Every owner shares the same instance of
+     * the tag, and testing, adding or removing a tag is a single bit operation.
+     *
+     * Views can AND the words of several tag sets to skip 64 entity indices at a time.
+     *
+     * @tparam Tag Empty component type
+     */
+    template <typename Tag>
+    class TagSet : public ISparseSet {
+      public:
+        static_assert(std::is_empty_v<Tag>, "TagSet only stores empty component types");
+
+        /** @brief Number of entity indices covered by one word of the bitset */
+        static constexpr size_t WORD_BITS = 64;
+
+        /**
+         * @brief Default constructor
+         */
+        TagSet() = default;
+
+        /**
+         * @brief Default destructor
+         */
+        ~TagSet() override = default;
+
+        /**
+         * @brief Tags an entity.
+         * @param index Entity index
+         */
+        void insert(size_t index, const Tag &tag = {});
+
+        /**
+         * @brief Tags an entity.
+         * @tparam Args Constructor parameter pack (ignored, a tag holds no state)
+         * @param index Entity index
+         * @return Reference to the shared tag instance
+         */
+        template <typename... Args>
+        Tag &emplace(size_t index, Args &&...args);
+
+        /**
+         * @brief Removes the tag of an entity, if any.
+         * @param index Entity index
+         */
+        void remove(size_t index) override;
+
+        /**
+         * @brief Checks if an entity owns the tag.
+         * @param index Entity index
+         * @return true if the bit of the index is set
+         */
+        bool contains(size_t index) const noexcept override;
+
+        /**
+         * @brief Accesses the tag of an entity.
+         * @param index Entity index
+         * @return Pointer to the shared tag instance, or nullptr if the entity has none
+         */
+        Tag *operator[](size_t index) noexcept;
+
+        const Tag *operator[](size_t index) const noexcept;
+
+        /**
+         * @brief Gets the number of tagged entities.
+         */
+        size_t size() const noexcept override;
+
+        /**
+         * @brief Checks if no entity owns the tag.
+         */
+        bool empty() const noexcept;
+
+        /**
+         * @brief Reserves room in the bitset.
+         * @param capacity Number of entity indices to cover without reallocating
+         */
+        void reserve(size_t capacity);
+
+        /**
+         * @brief Removes the tag from every entity.
+         */
+        void clear() noexcept override;
+
+        /**
+         * @brief Gets one word of the bitset.
+         * @param word Word position (entity indices [word * 64, word * 64 + 64))
+         * @return The bits of the word, 0 past the end of the bitset
+         */
+        uint64_t word(size_t word) const noexcept;
+
+        /**
+         * @brief Gets the number of words in the bitset.
+         */
+        size_t wordCount() const noexcept;
+
+        /**
+         * @brief Tags are not change-tracked.
+         * @return false
+         */
+        bool isTracking() const noexcept override;
+
+        /**
+         * @brief Tags are not change-tracked: nothing to clear.
+         */
+        void clearChanges() noexcept override;
+
+        /**
+         * @brief Copies the set.
+         * @return The new set
+         */
+        std::unique_ptr<ISparseSet> clone() const override;
+
+        /**
+         * @brief Measures the memory footprint of the set.
+         */
+        PoolStats stats() const noexcept override;
+
+        /**
+         * @brief Drops trailing empty words and releases unused capacity.
+         * @param prefix Unused: a tag set has no dense order
+         */
+        void compact(size_t prefix) override;
+
+        /**
+         * @brief Gets the snapshot key of the stored component type.
+         */
+        uint64_t typeKey() const noexcept override;
+
+        /**
+         * @brief Appends the content of the set to a snapshot.
+         * @param writer Snapshot buffer
+         */
+        void serialize(BinaryWriter &writer) const override;
+
+        /**
+         * @brief Replaces the content of the set with the one read from a snapshot.
+         *
+         * Pending change lists are dropped. The set is left untouched if the snapshot is invalid.
+         *
+         * @param reader Snapshot cursor
+         * @param indexLimit Number of entity indices of the snapshot
+         * @throws std::out_of_range if the snapshot is truncated
+         * @throws std::invalid_argument if a tagged entity index is not below indexLimit
+         */
+        void deserialize(BinaryReader &reader, size_t indexLimit) override;
+
+      private:
+        /** @brief One bit per entity index */
+        std::vector<uint64_t> _words = {};
+
+        /** @brief Number of set bits */
+        size_t _count = 0;
+
+        /** @brief Instance shared by every tagged entity */
+        Tag _tag = {};
+    };
+} // namespace Ecs
+
+#include "TagSet.tpp"
@@ -0,0 +1,173 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** TagSet
+*/
+
+#include <bit>
+#include <stdexcept>
+#include <typeinfo>
+#include <utility>
+
+namespace Ecs
+{
+    template <typename Tag>
+    void TagSet<Tag>::insert(size_t index, const Tag &)
+    {
+        emplace(index);
+    }
+
+    template <typename Tag>
+    template <typename... Args>
+    Tag &TagSet<Tag>::emplace(size_t index, Args &&...)
+    {
+        size_t word = index / WORD_BITS;
+        uint64_t bit = uint64_t{1} << (index % WORD_BITS);
+
+        if (word >= _words.size())
+            _words.resize(word + 1, 0);
+        if (!(_words[word] & bit)) {
+            _words[word] |= bit;
+            _count++;
+        }
+        return _tag;
+    }
+
+    template <typename Tag>
+    void TagSet<Tag>::remove(size_t index)
+    {
+        if (!contains(index))
+            return;
+        _words[index / WORD_BITS] &= ~(uint64_t{1} << (index % WORD_BITS));
+        _count--;
+    }
+
+    template <typename Tag>
+    bool TagSet<Tag>::contains(size_t index) const noexcept
+    {
+        return (word(index / WORD_BITS) >> (index % WORD_BITS)) & 1;
+    }
+
+    template <typename Tag>
+    Tag *TagSet<Tag>::operator[](size_t index) noexcept
+    {
+        return contains(index) ? &_tag : nullptr;
+    }
+
+    template <typename Tag>
+    const Tag *TagSet<Tag>::operator[](size_t index) const noexcept
+    {
+        return contains(index) ? &_tag : nullptr;
+    }
+
+    template <typename Tag>
+    size_t TagSet<Tag>::size() const noexcept
+    {
+        return _count;
+    }
+
+    template <typename Tag>
+    bool TagSet<Tag>::empty() const noexcept
+    {
+        return _count == 0;
+    }
+
+    template <typename Tag>
+    void TagSet<Tag>::reserve(size_t capacity)
+    {
+        _words.reserve((capacity + WORD_BITS - 1) / WORD_BITS);
+    }
+
+    template <typename Tag>
+    void TagSet<Tag>::clear() noexcept
+    {
+        _words.clear();
+        _count = 0;
+    }
+
+    template <typename Tag>
+    uint64_t TagSet<Tag>::word(size_t word) const noexcept
+    {
+        return word < _words.size() ? _words[word] : 0;
+    }
+
+    template <typename Tag>
+    size_t TagSet<Tag>::wordCount() const noexcept
+    {
+        return _words.size();
+    }
+
+    template <typename Tag>
+    bool TagSet<Tag>::isTracking() const noexcept
+    {
+        return false;
+    }
+
+    template <typename Tag>
+    void TagSet<Tag>::clearChanges() noexcept
+    {
+    }
+
+    template <typename Tag>
+    std::unique_ptr<ISparseSet> TagSet<Tag>::clone() const
+    {
+        return std::make_unique<TagSet>(*this);
+    }
+
+    template <typename Tag>
+    PoolStats TagSet<Tag>::stats() const noexcept
+    {
+        PoolStats stats;
+
+        stats.name = typeid(Tag).name();
+        stats.slots = _words.size() * WORD_BITS;
+        stats.live = _count;
+        stats.bytesReserved = _words.capacity() * sizeof(uint64_t);
+        stats.bytesUsed = (_count + 7) / 8;
+        return stats;
+    }
+
+    template <typename Tag>
+    void TagSet<Tag>::compact(size_t)
+    {
+        while (!_words.empty() && _words.back() == 0)
+            _words.pop_back();
+        _words.shrink_to_fit();
+    }
+
+    template <typename Tag>
+    uint64_t TagSet<Tag>::typeKey() const noexcept
+    {
+        return Ecs::typeKey<Tag>();
+    }
+
+    template <typename Tag>
+    void TagSet<Tag>::serialize(BinaryWriter &writer) const
+    {
+        writer.write(static_cast<uint64_t>(_words.size()));
+        writer.write(_words.data(), _words.size() * sizeof(uint64_t));
+    }
+
+    template <typename Tag>
+    void TagSet<Tag>::deserialize(BinaryReader &reader, size_t indexLimit)
+    {
+        auto count = reader.read<uint64_t>();
+
+        if (count > reader.remaining() / sizeof(uint64_t))
+            throw std::out_of_range("{TagSet::deserialize} Snapshot is truncated");
+        std::vector<uint64_t> words(static_cast<size_t>(count));
+
+        reader.read(words.data(), words.size() * sizeof(uint64_t));
+        for (size_t word = indexLimit / WORD_BITS; word < words.size(); ++word) {
+            uint64_t outside = word == indexLimit / WORD_BITS ? ~uint64_t{0} << (indexLimit % WORD_BITS) : ~uint64_t{0};
+
+            if (words[word] & outside)
+                throw std::invalid_argument("{TagSet::deserialize} Entity index out of range");
+        }
+        _words = std::move(words);
+        _count = 0;
+        for (uint64_t word : _words)
+            _count += static_cast<size_t>(std::popcount(word));
+    }
+}
@@ -0,0 +1,261 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** View
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Entity.hpp"
+#include "Filters.hpp"
+#include "Signature.hpp"
+#include "Storage.hpp"
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @class View
+     * @brief Iterable range over the entities owning a set of components.
+     *
+     * The iteration is driven by the smallest participating pool: its dense entity
+     * list is walked and each entity is accepted with a single AND-compare of its
+     * Signature against the view's mask.
+     * Dereferencing an iterator yields `std::tuple<Entity, Components &...>`, which
+     * works with range-for, structured bindings and standard algorithms.
+     *
+     * Tag components (empty types, stored in a TagSet) are checked by the signature
+     * compare. When a tag is rarer than every data component, the view walks the
+     * AND of the tag bitsets instead, a word at a time, skipping 64 entity indices
+     * per empty word; positions are then entity indices rather than dense positions.
+     *
+     * Components listed as `const T` are accessed read-only, which does not mark
+     * them as changed in pools tracking changes.
+     *
+     * Excluded components are folded into the same compare: an entity matches when
+     * `(signature & (required | excluded)) == required`. Components listed as
+     * `Optional<T>` take no part in the filtering and are yielded as `T *`.
+     *
+     * each() lets the callback remove or destroy the entity it is given: the walk follows
+     * the live size of the driving pool and revisits the slot the removal swapped an
+     * entity into. Removing other entities during a walk may skip some of them, and
+     * iterators must not be used across removals.
+     *
+     * A view is a lightweight handle: it must not outlive the Registry that created it.
+     *
+     * @tparam Components List of required (or Optional) component types
+     */
+    template <typename... Components>
+    class View {
+      public:
+        static_assert((!isOptional<Components> || ...), "A view needs at least one required component");
+
+        /** @brief Pool storing a component type (Optional and const qualifiers are ignored) */
+        template <typename C>
+        using Pool = Storage<ComponentOf<C>>;
+
+        /** @brief Value yielded for a component: a reference, or a pointer for Optional ones */
+        template <typename C>
+        using Ref = std::conditional_t<isOptional<C>, typename Unwrap<C>::type *, C &>;
+
+        /** @brief Element produced by the view */
+        using value_type = std::tuple<Entity, Ref<Components>...>;
+
+        /**
+         * @class Iterator
+         * @brief Forward iterator skipping entities that miss a component.
+         */
+        class Iterator {
+          public:
+            using iterator_category = std::input_iterator_tag;
+            using iterator_concept = std::forward_iterator_tag;
+            using value_type = View::value_type;
+            using difference_type = std::ptrdiff_t;
+            using reference = value_type;
+
+            /**
+             * @brief Default constructor (singular iterator)
+             */
+            Iterator() = default;
+
+            /**
+             * @brief Constructs an iterator on a position of the driving pool.
+             * @param view View being iterated
+             * @param pos Position in the driving pool's dense entity list (entity index when scanning tags)
+             */
+            Iterator(const View *view, size_t pos) noexcept;
+
+            /**
+             * @brief Gets the current entity and its components.
+             * @return Tuple of the entity handle and component references
+             */
+            value_type operator*() const;
+
+            /**
+             * @brief Advances to the next matching entity.
+             */
+            Iterator &operator++() noexcept;
+
+            Iterator operator++(int) noexcept;
+
+            bool operator==(const Iterator &other) const noexcept;
+
+          private:
+            /**
+             * @brief Moves forward until the current position matches every component.
+             */
+            void skip() noexcept;
+
+            /** @brief View being iterated */
+            const View *_view = nullptr;
+
+            /** @brief Position in the driving pool's dense entity list */
+            size_t _pos = 0;
+        };
+
+        /**
+         * @brief Constructs a view over a set of pools.
+         *
+         * If the pool of a required component is missing, the view is empty.
+         *
+         * @param pools Pools of each component (nullptr if not registered)
+         * @param excluded Signature of the components matching entities must not own
+         * @param generations Generation of each entity index, used to build handles
+         * @param signatures Signature of each entity index
+         * @throws std::length_error if a component type got an ID past MAX_COMPONENTS
+         */
+        View(std::tuple<Pool<Components> *...> pools, Signature excluded, const std::vector<uint32_t> &generations,
+            const std::vector<Signature> &signatures);
+
+        /**
+         * @brief Iterator to the first matching entity.
+         */
+        Iterator begin() const noexcept;
+
+        /**
+         * @brief Past-the-end iterator.
+         */
+        Iterator end() const noexcept;
+
+        /**
+         * @brief Calls a function on every matching entity.
+         *
+         * Function signature must be:
+         * `void(Entity, Components&...)`, with `T *` for `Optional<T>`
+         *
+         * @param fn Function called for each matching entity
+         */
+        template <typename Function>
+        void each(Function fn) const;
+
+        /**
+         * @brief Calls a function on the matching entities of a slice of the driving pool.
+         *
+         * Slices are independent, which lets parallelView split a view into chunks.
+         * Positions are fixed when the view is built: the callback must not add or
+         * remove components of the driving pool.
+         *
+         * @param begin First position in the driving pool's dense entity list (entity index when scanning tags)
+         * @param end Past-the-last position
+         * @param fn Function called for each matching entity
+         */
+        template <typename Function>
+        void each(size_t begin, size_t end, Function &fn) const;
+
+        /**
+         * @brief Upper bound of the number of matching entities.
+         * @return Size of the driving pool, or number of bits scanned when the tags drive the view
+         */
+        size_t sizeHint() const noexcept;
+
+        /**
+         * @brief Checks if the view is driven by a word scan of its tag bitsets.
+         */
+        bool scansTags() const noexcept;
+
+      private:
+        /** @brief Number of entity indices covered by one word of a tag bitset */
+        static constexpr size_t WORD_BITS = 64;
+
+        /**
+         * @brief Checks if a view component is a tag taking part in the filtering.
+         */
+        template <typename C>
+        static constexpr bool isRequiredTag = !isOptional<C> && std::is_empty_v<ComponentOf<C>>;
+
+        /**
+         * @brief Checks if an entity index owns every required component and no excluded one.
+         * @param index Entity index
+         */
+        bool matches(size_t index) const noexcept;
+
+        /**
+         * @brief Number of positions to walk right now (live size of the driving pool).
+         */
+        size_t extent() const noexcept;
+
+        /**
+         * @brief Gets the entity index at a position of the view.
+         * @param pos Position in the driving pool, or entity index when scanning tags
+         */
+        size_t entityAt(size_t pos) const noexcept;
+
+        /**
+         * @brief Gets the first matching position at or after pos.
+         * @param pos Starting position
+         * @return Matching position, or extent() if there is none
+         */
+        size_t seek(size_t pos) const noexcept;
+
+        /**
+         * @brief ANDs one word of every tag bitset of the view.
+         * @param word Word position
+         * @return Bits of the entity indices owning every tag in the word
+         */
+        uint64_t tagWord(size_t word) const noexcept;
+
+        /**
+         * @brief Gets a component of a matching entity, read-only for const types.
+         * @param index Entity index
+         * @return Reference to the component, or pointer (nullptr if absent) for Optional ones
+         */
+        template <typename C>
+        Ref<C> fetch(size_t index) const noexcept;
+
+        /** @brief Pools of each component */
+        std::tuple<Pool<Components> *...> _pools = {};
+
+        /** @brief Signature of the required components */
+        Signature _mask = {};
+
+        /** @brief Signature of the required and excluded components */
+        Signature _filter = {};
+
+        /** @brief Signature of each entity index */
+        const std::vector<Signature> *_signatures = nullptr;
+
+        /** @brief Dense entity list of the smallest data pool (nullptr if empty or scanning tags) */
+        const std::vector<size_t> *_driver = nullptr;
+
+        /** @brief true if the tag bitsets drive the iteration */
+        bool _scan = false;
+
+        /** @brief Number of positions to walk, fixed when the view is built (slices of parallelView) */
+        size_t _extent = 0;
+
+        /** @brief Generation of each entity index */
+        const std::vector<uint32_t> *_generations = nullptr;
+    };
+} // namespace Ecs
+
+#include "View.tpp"
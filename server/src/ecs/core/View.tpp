@@ -0,0 +1,251 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** View
+*/
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <limits>
+
+namespace Ecs
+{
+    template <typename... Components>
+    View<Components...>::View(std::tuple<Pool<Components> *...> pools, Signature excluded,
+        const std::vector<uint32_t> &generations, const std::vector<Signature> &signatures)
+        : _pools(pools), _signatures(&signatures), _generations(&generations)
+    {
+        (
+            [&] {
+                if constexpr (!isOptional<Components>)
+                    _mask |= signatureOf<ComponentOf<Components>>();
+            }(),
+            ...);
+        _filter = _mask | excluded;
+        if (((!isOptional<Components> && !std::get<Pool<Components> *>(_pools)) || ...))
+            return;
+        const std::vector<size_t> *smallest = nullptr;
+        size_t rarestTag = std::numeric_limits<size_t>::max();
+        size_t words = std::numeric_limits<size_t>::max();
+
+        (
+            [&] {
+                auto *pool = std::get<Pool<Components> *>(_pools);
+
+                if constexpr (isOptional<Components>) {
+                    return;
+                } else if constexpr (std::is_empty_v<Components>) {
+                    rarestTag = std::min(rarestTag, pool->size());
+                    words = std::min(words, pool->wordCount());
+                } else if (!smallest || pool->size() < smallest->size()) {
+                    smallest = &pool->entities();
+                }
+            }(),
+            ...);
+        if (!smallest || rarestTag < smallest->size()) {
+            _scan = true;
+            _extent = words * WORD_BITS;
+            return;
+        }
+        _driver = smallest;
+        _extent = smallest->size();
+    }
+
+    template <typename... Components>
+    typename View<Components...>::Iterator View<Components...>::begin() const noexcept
+    {
+        return Iterator(this, 0);
+    }
+
+    template <typename... Components>
+    typename View<Components...>::Iterator View<Components...>::end() const noexcept
+    {
+        return Iterator(this, sizeHint());
+    }
+
+    template <typename... Components>
+    template <typename Function>
+    void View<Components...>::each(Function fn) const
+    {
+        if (!_driver) {
+            each(0, _extent, fn);
+            return;
+        }
+        for (size_t i = 0; i < _driver->size();) {
+            size_t idx = (*_driver)[i];
+
+            if (matches(idx))
+                fn(Entity(idx, (*_generations)[idx]), fetch<Components>(idx)...);
+            if (i >= _driver->size() || (*_driver)[i] == idx)
+                ++i;
+        }
+    }
+
+    template <typename... Components>
+    template <typename Function>
+    void View<Components...>::each(size_t begin, size_t end, Function &fn) const
+    {
+        end = std::min(end, _extent);
+        if (!_scan) {
+            assert((!_driver || _driver->size() == _extent) && "View::each: the driving pool changed size");
+            for (size_t i = begin; i < end; ++i) {
+                size_t idx = (*_driver)[i];
+
+                if (matches(idx))
+                    fn(Entity(idx, (*_generations)[idx]), fetch<Components>(idx)...);
+            }
+            return;
+        }
+        for (size_t word = begin / WORD_BITS; word * WORD_BITS < end; ++word) {
+            uint64_t set = tagWord(word);
+
+            if (word * WORD_BITS < begin)
+                set &= ~uint64_t{0} << (begin % WORD_BITS);
+            if ((word + 1) * WORD_BITS > end)
+                set &= (uint64_t{1} << (end % WORD_BITS)) - 1;
+            for (; set; set &= set - 1) {
+                size_t idx = word * WORD_BITS + static_cast<size_t>(std::countr_zero(set));
+
+                if (matches(idx))
+                    fn(Entity(idx, (*_generations)[idx]), fetch<Components>(idx)...);
+            }
+        }
+    }
+
+    template <typename... Components>
+    size_t View<Components...>::sizeHint() const noexcept
+    {
+        return _extent;
+    }
+
+    template <typename... Components>
+    bool View<Components...>::scansTags() const noexcept
+    {
+        return _scan;
+    }
+
+    template <typename... Components>
+    bool View<Components...>::matches(size_t index) const noexcept
+    {
+        return ((*_signatures)[index] & _filter) == _mask;
+    }
+
+    template <typename... Components>
+    size_t View<Components...>::extent() const noexcept
+    {
+        return _driver ? _driver->size() : _extent;
+    }
+
+    template <typename... Components>
+    size_t View<Components...>::entityAt(size_t pos) const noexcept
+    {
+        return _scan ? pos : (*_driver)[pos];
+    }
+
+    template <typename... Components>
+    size_t View<Components...>::seek(size_t pos) const noexcept
+    {
+        if (!_scan) {
+            while (pos < extent() && !matches((*_driver)[pos]))
+                ++pos;
+            return std::min(pos, extent());
+        }
+        while (pos < _extent) {
+            uint64_t set = tagWord(pos / WORD_BITS) & (~uint64_t{0} << (pos % WORD_BITS));
+
+            if (!set) {
+                pos = (pos / WORD_BITS + 1) * WORD_BITS;
+                continue;
+            }
+            pos = pos / WORD_BITS * WORD_BITS + static_cast<size_t>(std::countr_zero(set));
+            if (matches(pos))
+                return pos;
+            ++pos;
+        }
+        return _extent;
+    }
+
+    template <typename... Components>
+    uint64_t View<Components...>::tagWord(size_t word) const noexcept
+    {
+        uint64_t set = ~uint64_t{0};
+
+        (
+            [&] {
+                if constexpr (isRequiredTag<Components>)
+                    set &= std::get<Pool<Components> *>(_pools)->word(word);
+            }(),
+            ...);
+        return set;
+    }
+
+    template <typename... Components>
+    template <typename C>
+    typename View<Components...>::template Ref<C> View<Components...>::fetch(size_t index) const noexcept
+    {
+        Pool<C> *pool = std::get<Pool<C> *>(_pools);
+
+        if constexpr (isOptional<C>) {
+            if (!pool)
+                return nullptr;
+            if constexpr (std::is_const_v<typename Unwrap<C>::type>)
+                return std::as_const(*pool)[index];
+            else
+                return (*pool)[index];
+        } else if constexpr (std::is_const_v<C>) {
+            return *std::as_const(*pool)[index];
+        } else {
+            return *(*pool)[index];
+        }
+    }
+
+    template <typename... Components>
+    View<Components...>::Iterator::Iterator(const View *view, size_t pos) noexcept : _view(view), _pos(pos)
+    {
+        skip();
+    }
+
+    template <typename... Components>
+    typename View<Components...>::value_type View<Components...>::Iterator::operator*() const
+    {
+        size_t idx = _view->entityAt(_pos);
+
+        return value_type(
+            Entity(idx, (*_view->_generations)[idx]), _view->template fetch<Components>(idx)...);
+    }
+
+    template <typename... Components>
+    typename View<Components...>::Iterator &View<Components...>::Iterator::operator++() noexcept
+    {
+        ++_pos;
+        skip();
+        return *this;
+    }
+
+    template <typename... Components>
+    typename View<Components...>::Iterator View<Components...>::Iterator::operator++(int) noexcept
+    {
+        Iterator copy = *this;
+
+        ++*this;
+        return copy;
+    }
+
+    template <typename... Components>
+    bool View<Components...>::Iterator::operator==(const Iterator &other) const noexcept
+    {
+        if (!_view)
+            return _pos == other._pos;
+        size_t last = _view->extent();
+
+        return std::min(_pos, last) == std::min(other._pos, last);
+    }
+
+    template <typename... Components>
+    void View<Components...>::Iterator::skip() noexcept
+    {
+        _pos = _view->seek(_pos);
+    }
+}
@@ -0,0 +1,43 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ICommandQueue
+*/
+
+#pragma once
+#include <vector>
+#include "Entity.hpp"
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    class Registry;
+
+    /**
+     * @interface ICommandQueue
+     * @brief Type-erased queue of deferred operations on one component type.
+     */
+    class ICommandQueue {
+      public:
+        /**
+         * @brief Virtual destructor.
+         */
+        virtual ~ICommandQueue() = default;
+
+        /**
+         * @brief Applies the queued emplacements and removals to a registry, in recording order per entity.
+         * @param registry Target registry
+         * @param created Entities created for the buffer's placeholders, by placeholder index
+         */
+        virtual void apply(Registry &registry, const std::vector<Entity> &created) = 0;
+
+        /**
+         * @brief Drops every queued operation.
+         */
+        virtual void clear() noexcept = 0;
+    };
+} // namespace Ecs
@@ -0,0 +1,90 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** IGroup
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "ISparseSet.hpp"
+#include "Signature.hpp"
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @interface IGroup
+     * @brief Type-erased view of an owning group.
+     *
+     * Lets the Registry keep the packed prefix of grouped pools up to date
+     * when components are added or removed.
+     */
+    class IGroup {
+      public:
+        /**
+         * @brief Virtual destructor.
+         */
+        virtual ~IGroup() = default;
+
+        /**
+         * @brief Gets the signature of the owned component types.
+         * @return The group mask
+         */
+        virtual Signature mask() const noexcept = 0;
+
+        /**
+         * @brief Checks if an entity is packed in the group.
+         * @param index Entity index
+         */
+        virtual bool contains(size_t index) const noexcept = 0;
+
+        /**
+         * @brief Packs an entity that now owns every grouped component.
+         * @param index Entity index
+         * @throws std::bad_alloc if a sparse page shared with a fork cannot be copied
+         */
+        virtual void enter(size_t index) = 0;
+
+        /**
+         * @brief Unpacks an entity that is about to lose a grouped component.
+         *
+         * Does nothing if the entity is not in the group.
+         *
+         * @param index Entity index
+         * @throws std::bad_alloc if a sparse page shared with a fork cannot be copied
+         */
+        virtual void leave(size_t index) = 0;
+
+        /**
+         * @brief Gets the number of entities in the group.
+         */
+        virtual size_t size() const noexcept = 0;
+
+        /**
+         * @brief Packs again every matching entity, after the owned pools were replaced.
+         */
+        virtual void refresh() noexcept = 0;
+
+        /**
+         * @brief Points the group at the generation table of the Registry it was moved into.
+         * @param generations Generation table of the Registry now holding the group
+         */
+        virtual void rebind(const std::vector<uint32_t> &generations) noexcept = 0;
+
+        /**
+         * @brief Creates the same group over the pools of another Registry.
+         * @param pools Pools of the other Registry, indexed by ComponentId
+         * @param generations Generation table of the other Registry
+         * @return The new group, already packed
+         */
+        virtual std::unique_ptr<IGroup> clone(
+            const std::vector<std::shared_ptr<ISparseSet>> &pools, const std::vector<uint32_t> &generations) const = 0;
+    };
+} // namespace Ecs
@@ -0,0 +1,118 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ISparseSet
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "BinaryReader.hpp"
+#include "BinaryWriter.hpp"
+#include "PoolStats.hpp"
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @interface ISparseSet
+     * @brief Type-erased view of a component pool.
+     *
+     * Lets the Registry store every pool in one flat container and run
+     * type-independent operations (such as entity destruction) on them.
+     */
+    class ISparseSet {
+      public:
+        /**
+         * @brief Virtual destructor.
+         */
+        virtual ~ISparseSet() = default;
+
+        /**
+         * @brief Removes the component of an entity, if any.
+         * @param index Entity index
+         * @throws std::bad_alloc if a sparse page shared with a fork must be copied
+         */
+        virtual void remove(size_t index) = 0;
+
+        /**
+         * @brief Checks if an entity owns a component in this pool.
+         * @param index Entity index
+         * @return true if a component is stored for this index
+         */
+        virtual bool contains(size_t index) const noexcept = 0;
+
+        /**
+         * @brief Gets the number of stored components.
+         * @return Number of live components
+         */
+        virtual size_t size() const noexcept = 0;
+
+        /**
+         * @brief Removes every component from the pool.
+         */
+        virtual void clear() noexcept = 0;
+
+        /**
+         * @brief Checks if the pool records changes.
+         */
+        virtual bool isTracking() const noexcept = 0;
+
+        /**
+         * @brief Starts a new change-tracking tick.
+         */
+        virtual void clearChanges() noexcept = 0;
+
+        /**
+         * @brief Copies the pool, for a Registry fork about to modify it.
+         *
+         * Storage that can stay shared between the copies (such as sparse pages)
+         * is only copied once one of them writes to it.
+         *
+         * @return The new pool
+         */
+        virtual std::unique_ptr<ISparseSet> clone() const = 0;
+
+        /**
+         * @brief Measures the memory footprint of the pool.
+         * @return Statistics of the pool (the id field is left to the caller)
+         */
+        virtual PoolStats stats() const noexcept = 0;
+
+        /**
+         * @brief Releases unused capacity and renumbers the dense storage by entity index.
+         *
+         * The first prefix dense slots and the remaining ones are sorted separately, so
+         * the pools of a group keep the same packed prefix, in the same order.
+         *
+         * @param prefix Number of leading slots packed by a group (0 if none)
+         */
+        virtual void compact(size_t prefix) = 0;
+
+        /**
+         * @brief Gets the snapshot key of the stored component type.
+         */
+        virtual uint64_t typeKey() const noexcept = 0;
+
+        /**
+         * @brief Appends the content of the pool to a snapshot.
+         * @param writer Snapshot buffer
+         */
+        virtual void serialize(BinaryWriter &writer) const = 0;
+
+        /**
+         * @brief Replaces the content of the pool with the one read from a snapshot.
+         *
+         * The pool is left untouched if the snapshot is invalid.
+         *
+         * @param reader Snapshot cursor
+         * @param indexLimit Number of entity indices of the snapshot; every stored index must be below it
+         */
+        virtual void deserialize(BinaryReader &reader, size_t indexLimit) = 0;
+    };
+} // namespace Ecs
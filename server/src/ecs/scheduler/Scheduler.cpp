@@ -0,0 +1,121 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Scheduler
+*/
+
+#include "Scheduler.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+namespace Ecs
+{
+    void Scheduler::run(Registry &registry, Thread::ThreadPool &pool)
+    {
+        auto start = std::chrono::steady_clock::now();
+        size_t count = _systems.size();
+        auto waiting = std::make_unique<std::atomic<size_t>[]>(count);
+        std::atomic<size_t> remaining = count;
+        std::exception_ptr error = nullptr;
+        std::mutex errorMutex;
+        std::function<void(size_t)> launch;
+
+        buildGraph();
+        for (size_t i = 0; i < count; ++i)
+            waiting[i].store(_dependencyCount[i]);
+        launch = [&](size_t index) {
+            pool.submit([&, index]() {
+                try {
+                    runSystem(index, registry);
+                } catch (...) {
+                    std::lock_guard lock(errorMutex);
+                    if (!error)
+                        error = std::current_exception();
+                }
+                for (size_t dependent : _dependents[index])
+                    if (waiting[dependent].fetch_sub(1) == 1)
+                        launch(dependent);
+                remaining.fetch_sub(1);
+            });
+        };
+        for (size_t i = 0; i < count; ++i)
+            if (_dependencyCount[i] == 0)
+                launch(i);
+        pool.helpWhile([&remaining]() {
+            return remaining.load() > 0;
+        });
+        if (error) {
+            for (auto &entry : _systems)
+                entry.commands.clear();
+            std::rethrow_exception(error);
+        }
+        for (auto &entry : _systems)
+            entry.commands.apply(registry);
+        _lastTick = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    }
+
+    const std::vector<SystemStats> &Scheduler::getStats() const noexcept
+    {
+        return _stats;
+    }
+
+    std::chrono::nanoseconds Scheduler::getLastTickDuration() const noexcept
+    {
+        return _lastTick;
+    }
+
+    std::vector<size_t> Scheduler::getDependencies(size_t index) const
+    {
+        std::vector<size_t> dependencies;
+
+        for (size_t i = 0; i < index && i < _systems.size(); ++i)
+            if (conflicts(_systems[i], _systems[index]))
+                dependencies.push_back(i);
+        return dependencies;
+    }
+
+    size_t Scheduler::size() const noexcept
+    {
+        return _systems.size();
+    }
+
+    bool Scheduler::conflicts(const Entry &lhs, const Entry &rhs) noexcept
+    {
+        return (lhs.writes & (rhs.reads | rhs.writes)).any() || (lhs.reads & rhs.writes).any();
+    }
+
+    void Scheduler::buildGraph()
+    {
+        size_t count = _systems.size();
+
+        _dependents.assign(count, {});
+        _dependencyCount.assign(count, 0);
+        for (size_t j = 0; j < count; ++j) {
+            for (size_t i = 0; i < j; ++i) {
+                if (!conflicts(_systems[i], _systems[j]))
+                    continue;
+                _dependents[i].push_back(j);
+                _dependencyCount[j]++;
+            }
+        }
+    }
+
+    void Scheduler::runSystem(size_t index, Registry &registry)
+    {
+        auto start = std::chrono::steady_clock::now();
+        Entry &entry = _systems[index];
+
+        entry.system(registry, entry.commands);
+        auto elapsed =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        SystemStats &stats = _stats[index];
+        stats.last = elapsed;
+        stats.worst = std::max(stats.worst, elapsed);
+        stats.total += elapsed;
+        stats.runs++;
+    }
+} // namespace Ecs
@@ -0,0 +1,167 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Scheduler
+*/
+
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "CommandBuffer.hpp"
+#include "Registry.hpp"
+#include "Signature.hpp"
+#include "ThreadPool.hpp"
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @struct Reads
+     * @brief Lists the component types a system only reads.
+     *
+     * Readers of a type run concurrently, so a system must only iterate its read
+     * components as const (`view<const T>`, `view<Position, const Velocity>`).
+     * A non-const access writes the change stamps of a tracked pool and may copy a
+     * pool shared with a fork, which races with the other readers.
+     */
+    template <typename... Components>
+    struct Reads {};
+
+    /**
+     * @struct Writes
+     * @brief Lists the component types a system modifies.
+     */
+    template <typename... Components>
+    struct Writes {};
+
+    /**
+     * @struct SystemStats
+     * @brief Timing of a system over the ticks it ran.
+     */
+    struct SystemStats {
+        std::string name = "";              ///> Name given to addSystem
+        std::chrono::nanoseconds last {0};  ///> Duration of the last run
+        std::chrono::nanoseconds worst {0}; ///> Longest run so far
+        std::chrono::nanoseconds total {0}; ///> Accumulated duration of every run
+        size_t runs = 0;                    ///> Number of runs
+    };
+
+    /**
+     * @class Scheduler
+     * @brief Runs systems each tick, in parallel when their component accesses allow it.
+     *
+     * Each system declares the components it reads and writes. On every tick the
+     * scheduler builds a dependency graph: a system waits for the earlier registered
+     * systems it conflicts with (one writes a component the other reads or writes).
+     * Systems without conflicts run at the same time on a thread pool.
+     *
+     * A system must not touch components outside its declared sets, must access its
+     * Reads components through const views only, and must not make
+     * structural changes on the Registry: it receives its own CommandBuffer instead.
+     * The buffers are applied in registration order once every system is done.
+     */
+    class Scheduler {
+      public:
+        /** @brief Signature of a system */
+        using System = std::function<void(Registry &, CommandBuffer &)>;
+
+        /**
+         * @brief Registers a system, run after the systems registered before it.
+         *
+         * Components are declared as plain types: constness is expressed by the views
+         * of the system, and `Reads<const T>` is rejected at compile time.
+         *
+         * @tparam Read Components only read by the system
+         * @tparam Write Components modified by the system
+         * @param name Name used in the stats
+         * @param system Function run once per tick
+         */
+        template <typename... Read, typename... Write>
+        void addSystem(std::string name, Reads<Read...>, Writes<Write...>, System system);
+
+        /**
+         * @brief Runs every system once, then applies their command buffers.
+         *
+         * If systems throw, the first exception is rethrown once every system is done,
+         * and the command buffers are dropped.
+         *
+         * @param registry Registry the systems work on
+         * @param pool Thread pool running the systems
+         */
+        void run(Registry &registry, Thread::ThreadPool &pool = Thread::ThreadPool::shared());
+
+        /**
+         * @brief Gets the timing of each system, in registration order.
+         */
+        const std::vector<SystemStats> &getStats() const noexcept;
+
+        /**
+         * @brief Gets the duration of the last run, command buffers included.
+         */
+        std::chrono::nanoseconds getLastTickDuration() const noexcept;
+
+        /**
+         * @brief Gets the earlier systems a system waits for.
+         * @param index Registration index of the system
+         * @return Registration indices of its direct dependencies
+         */
+        std::vector<size_t> getDependencies(size_t index) const;
+
+        /**
+         * @brief Gets the number of registered systems.
+         */
+        size_t size() const noexcept;
+
+      private:
+        /**
+         * @struct Entry
+         * @brief A registered system and its access sets.
+         */
+        struct Entry {
+            System system = nullptr;     ///> Function run each tick
+            Signature reads = {};        ///> Components only read
+            Signature writes = {};       ///> Components modified
+            CommandBuffer commands = {}; ///> Structural changes recorded during the tick
+        };
+
+        /**
+         * @brief Checks if two systems cannot run at the same time.
+         */
+        static bool conflicts(const Entry &lhs, const Entry &rhs) noexcept;
+
+        /**
+         * @brief Rebuilds the dependency graph from the access sets.
+         */
+        void buildGraph();
+
+        /**
+         * @brief Runs one system and records its duration.
+         */
+        void runSystem(size_t index, Registry &registry);
+
+        /** @brief Registered systems */
+        std::vector<Entry> _systems = {};
+
+        /** @brief Timing of each system */
+        std::vector<SystemStats> _stats = {};
+
+        /** @brief Later systems waiting for each system */
+        std::vector<std::vector<size_t>> _dependents = {};
+
+        /** @brief Number of systems each system waits for */
+        std::vector<size_t> _dependencyCount = {};
+
+        /** @brief Duration of the last run */
+        std::chrono::nanoseconds _lastTick {0};
+    };
+} // namespace Ecs
+
+#include "Scheduler.tpp"
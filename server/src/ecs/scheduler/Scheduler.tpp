@@ -0,0 +1,23 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Scheduler
+*/
+
+namespace Ecs
+{
+    template <typename... Read, typename... Write>
+    void Scheduler::addSystem(std::string name, Reads<Read...>, Writes<Write...>, System system)
+    {
+        static_assert(((!std::is_const_v<Read>) && ...) && ((!std::is_const_v<Write>) && ...),
+            "Declare plain component types, and iterate Reads components with view<const T>");
+        Entry entry;
+
+        entry.system = std::move(system);
+        entry.reads = signatureOf<Read...>();
+        entry.writes = signatureOf<Write...>();
+        _systems.push_back(std::move(entry));
+        _stats.push_back(SystemStats {std::move(name)});
+    }
+}
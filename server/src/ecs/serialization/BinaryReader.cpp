@@ -0,0 +1,45 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** BinaryReader
+*/
+
+#include "BinaryReader.hpp"
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+namespace Ecs
+{
+    BinaryReader::BinaryReader(std::span<const std::byte> data) noexcept : _data(data)
+    {
+    }
+
+    void BinaryReader::read(void *data, size_t size)
+    {
+        if (size > remaining())
+            throw std::out_of_range("{BinaryReader::read} Snapshot is truncated");
+        if (size == 0)
+            return;
+        std::memcpy(data, _data.data() + _offset, size);
+        _offset += size;
+    }
+
+    std::string BinaryReader::readString()
+    {
+        auto size = read<uint64_t>();
+
+        if (size > remaining())
+            throw std::out_of_range("{BinaryReader::readString} Snapshot is truncated");
+        std::string value(static_cast<size_t>(size), '\0');
+
+        read(value.data(), value.size());
+        return value;
+    }
+
+    size_t BinaryReader::remaining() const noexcept
+    {
+        return _data.size() - _offset;
+    }
+} // namespace Ecs
@@ -0,0 +1,66 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** BinaryReader
+*/
+
+#pragma once
+#include <cstddef>
+#include <span>
+#include <string>
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @class BinaryReader
+     * @brief Cursor over the bytes of a snapshot written by a BinaryWriter.
+     *
+     * The reader does not own the bytes: they must outlive it.
+     */
+    class BinaryReader {
+      public:
+        /**
+         * @brief Constructs a reader at the start of a byte range.
+         * @param data Bytes to read
+         */
+        explicit BinaryReader(std::span<const std::byte> data) noexcept;
+
+        /**
+         * @brief Copies the next bytes out of the snapshot.
+         * @param data Destination
+         * @param size Number of bytes
+         * @throws std::out_of_range if fewer than size bytes remain
+         */
+        void read(void *data, size_t size);
+
+        /**
+         * @brief Reads a trivially copyable value.
+         * @tparam T Value type
+         * @throws std::out_of_range if the snapshot is truncated
+         */
+        template <typename T>
+        T read();
+
+        /**
+         * @brief Reads a length-prefixed string.
+         * @throws std::out_of_range if the snapshot is truncated
+         */
+        std::string readString();
+
+        /**
+         * @brief Gets the number of bytes left to read.
+         */
+        size_t remaining() const noexcept;
+
+      private:
+        std::span<const std::byte> _data = {}; ///> Bytes of the snapshot
+        size_t _offset = 0;                    ///> Position of the next byte to read
+    };
+} // namespace Ecs
+
+#include "BinaryReader.tpp"
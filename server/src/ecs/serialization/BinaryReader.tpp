@@ -0,0 +1,21 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** BinaryReader
+*/
+
+#include <type_traits>
+
+namespace Ecs
+{
+    template <typename T>
+    T BinaryReader::read()
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "BinaryReader::read needs a trivially copyable type");
+        T value;
+
+        read(&value, sizeof(T));
+        return value;
+    }
+}
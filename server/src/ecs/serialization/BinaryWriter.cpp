@@ -0,0 +1,39 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** BinaryWriter
+*/
+
+#include "BinaryWriter.hpp"
+#include <cstdint>
+#include <cstring>
+
+namespace Ecs
+{
+    void BinaryWriter::write(const void *data, size_t size)
+    {
+        if (size == 0)
+            return;
+        size_t offset = _buffer.size();
+
+        _buffer.resize(offset + size);
+        std::memcpy(_buffer.data() + offset, data, size);
+    }
+
+    void BinaryWriter::writeString(const std::string &value)
+    {
+        write(static_cast<uint64_t>(value.size()));
+        write(value.data(), value.size());
+    }
+
+    const std::vector<std::byte> &BinaryWriter::data() const noexcept
+    {
+        return _buffer;
+    }
+
+    void BinaryWriter::clear() noexcept
+    {
+        _buffer.clear();
+    }
+} // namespace Ecs
@@ -0,0 +1,64 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** BinaryWriter
+*/
+
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @class BinaryWriter
+     * @brief Growable byte buffer receiving a Registry snapshot.
+     *
+     * Values are copied in host byte order: a snapshot is meant to be read back
+     * by the same server build (rollback, crash recovery, room transfer).
+     */
+    class BinaryWriter {
+      public:
+        /**
+         * @brief Appends raw bytes.
+         * @param data First byte to copy
+         * @param size Number of bytes
+         */
+        void write(const void *data, size_t size);
+
+        /**
+         * @brief Appends the bytes of a trivially copyable value.
+         * @tparam T Value type
+         * @param value Value to copy
+         */
+        template <typename T>
+        void write(const T &value);
+
+        /**
+         * @brief Appends a length-prefixed string.
+         * @param value String to copy
+         */
+        void writeString(const std::string &value);
+
+        /**
+         * @brief Gets the bytes written so far.
+         */
+        const std::vector<std::byte> &data() const noexcept;
+
+        /**
+         * @brief Drops the written bytes, keeping the capacity for the next snapshot.
+         */
+        void clear() noexcept;
+
+      private:
+        std::vector<std::byte> _buffer = {}; ///> Written bytes
+    };
+} // namespace Ecs
+
+#include "BinaryWriter.tpp"
@@ -0,0 +1,18 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** BinaryWriter
+*/
+
+#include <type_traits>
+
+namespace Ecs
+{
+    template <typename T>
+    void BinaryWriter::write(const T &value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "BinaryWriter::write needs a trivially copyable type");
+        write(&value, sizeof(T));
+    }
+}
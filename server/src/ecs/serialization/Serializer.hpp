@@ -0,0 +1,85 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Serializer
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "BinaryReader.hpp"
+#include "BinaryWriter.hpp"
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @struct Serializer
+     * @brief Snapshot hook of a component type that is not trivially copyable.
+     *
+     * Trivially copyable components are dumped as raw contiguous blocks and need
+     * no hook. Other types specialize Serializer next to their definition:
+     * @code
+     * template <>
+     * struct Serializer<Drawable> {
+     *     static void write(BinaryWriter &writer, const Drawable &component);
+     *     static void read(BinaryReader &reader, Drawable &component);
+     * };
+     * @endcode
+     *
+     * @tparam T Component type
+     */
+    template <typename T>
+    struct Serializer {};
+
+    /**
+     * @brief Checks if a component type has a Serializer specialization.
+     */
+    template <typename T>
+    concept HasSerializer = requires(BinaryWriter &writer, BinaryReader &reader, const T &in, T &out) {
+        Serializer<T>::write(writer, in);
+        Serializer<T>::read(reader, out);
+    };
+
+    /**
+     * @brief Gets a key identifying a component type in snapshots.
+     *
+     * Unlike ComponentId, the key does not depend on the order in which types were
+     * first used, so it is stable between runs of the same build.
+     *
+     * @tparam T Component type
+     * @return FNV-1a hash of the type name
+     */
+    template <typename T>
+    uint64_t typeKey() noexcept;
+
+    /**
+     * @brief Writes a contiguous array of components.
+     *
+     * @tparam T Component type
+     * @param writer Snapshot buffer
+     * @param data First component
+     * @param count Number of components
+     * @throws std::logic_error if T is neither trivially copyable nor has a Serializer
+     */
+    template <typename T>
+    void writeComponents(BinaryWriter &writer, const T *data, size_t count);
+
+    /**
+     * @brief Reads a contiguous array of components written by writeComponents.
+     *
+     * @tparam T Component type
+     * @param reader Snapshot cursor
+     * @param data First component to overwrite
+     * @param count Number of components
+     * @throws std::logic_error if T is neither trivially copyable nor has a Serializer
+     */
+    template <typename T>
+    void readComponents(BinaryReader &reader, T *data, size_t count);
+} // namespace Ecs
+
+#include "Serializer.tpp"
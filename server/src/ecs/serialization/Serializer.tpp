@@ -0,0 +1,56 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Serializer
+*/
+
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <typeinfo>
+
+namespace Ecs
+{
+    template <typename T>
+    uint64_t typeKey() noexcept
+    {
+        static const uint64_t key = [] {
+            uint64_t hash = 14695981039346656037ULL;
+
+            for (char c : std::string_view(typeid(T).name())) {
+                hash ^= static_cast<unsigned char>(c);
+                hash *= 1099511628211ULL;
+            }
+            return hash;
+        }();
+
+        return key;
+    }
+
+    template <typename T>
+    void writeComponents(BinaryWriter &writer, const T *data, size_t count)
+    {
+        if constexpr (HasSerializer<T>) {
+            for (size_t i = 0; i < count; ++i)
+                Serializer<T>::write(writer, data[i]);
+        } else if constexpr (std::is_trivially_copyable_v<T>) {
+            writer.write(data, count * sizeof(T));
+        } else {
+            throw std::logic_error("{writeComponents} Component type has no Serializer");
+        }
+    }
+
+    template <typename T>
+    void readComponents(BinaryReader &reader, T *data, size_t count)
+    {
+        if constexpr (HasSerializer<T>) {
+            for (size_t i = 0; i < count; ++i)
+                Serializer<T>::read(reader, data[i]);
+        } else if constexpr (std::is_trivially_copyable_v<T>) {
+            reader.read(data, count * sizeof(T));
+        } else {
+            throw std::logic_error("{readComponents} Component type has no Serializer");
+        }
+    }
+}
@@ -0,0 +1,121 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** MovementSystem
+*/
+
+#include "MovementSystem.hpp"
+#include <algorithm>
+#include <cstddef>
+#include "Position.hpp"
+#include "Velocity.hpp"
+
+namespace
+{
+    void integrateScalar(float *positions, const float *velocities, size_t count, float dt, float low,
+        float high) noexcept
+    {
+        for (size_t i = 0; i < count; ++i)
+            positions[i] = std::min(std::max(positions[i] + velocities[i] * dt, low), high);
+    }
+
+#if SIMD_X86
+    SIMD_TARGET("sse4.1")
+    void integrateSse(float *positions, const float *velocities, size_t count, float dt, float low, float high) noexcept
+    {
+        const __m128 step = _mm_set1_ps(dt);
+        const __m128 lower = _mm_set1_ps(low);
+        const __m128 upper = _mm_set1_ps(high);
+        size_t i = 0;
+
+        for (; i + 4 <= count; i += 4) {
+            __m128 pos = _mm_add_ps(_mm_loadu_ps(positions + i), _mm_mul_ps(_mm_loadu_ps(velocities + i), step));
+
+            _mm_storeu_ps(positions + i, _mm_min_ps(_mm_max_ps(pos, lower), upper));
+        }
+        integrateScalar(positions + i, velocities + i, count - i, dt, low, high);
+    }
+
+    SIMD_TARGET("avx2")
+    void integrateAvx2(float *positions, const float *velocities, size_t count, float dt, float low,
+        float high) noexcept
+    {
+        const __m256 step = _mm256_set1_ps(dt);
+        const __m256 lower = _mm256_set1_ps(low);
+        const __m256 upper = _mm256_set1_ps(high);
+        size_t i = 0;
+
+        for (; i + 8 <= count; i += 8) {
+            __m256 pos =
+                _mm256_add_ps(_mm256_loadu_ps(positions + i), _mm256_mul_ps(_mm256_loadu_ps(velocities + i), step));
+
+            _mm256_storeu_ps(positions + i, _mm256_min_ps(_mm256_max_ps(pos, lower), upper));
+        }
+        integrateSse(positions + i, velocities + i, count - i, dt, low, high);
+    }
+#endif
+}
+
+namespace Ecs
+{
+    MovementSystem::MovementSystem(Bounds bounds) noexcept : _bounds(bounds), _level(Simd::detect())
+    {
+    }
+
+    void MovementSystem::update(Registry &registry, float dt)
+    {
+        _x.clear();
+        _y.clear();
+        _vx.clear();
+        _vy.clear();
+        registry.view<const Position, const Velocity>([this](Entity, const Position &pos, const Velocity &vel) {
+            _x.push_back(pos.x);
+            _y.push_back(pos.y);
+            _vx.push_back(vel.vx);
+            _vy.push_back(vel.vy);
+        });
+        integrate(_level, _x.data(), _vx.data(), _x.size(), dt, _bounds.minX, _bounds.maxX);
+        integrate(_level, _y.data(), _vy.data(), _y.size(), dt, _bounds.minY, _bounds.maxY);
+        size_t i = 0;
+
+        registry.view<Position, const Velocity>([this, &i](Entity, Position &pos, const Velocity &) {
+            pos.x = _x[i];
+            pos.y = _y[i];
+            ++i;
+        });
+    }
+
+    void MovementSystem::integrate(Simd::Level level, float *positions, const float *velocities, size_t count,
+        float dt, float low, float high) noexcept
+    {
+        [[maybe_unused]] const Simd::Level kernel = Simd::clamp(level);
+
+#if SIMD_X86
+        if (kernel == Simd::Level::Avx2) {
+            integrateAvx2(positions, velocities, count, dt, low, high);
+            return;
+        }
+        if (kernel == Simd::Level::Sse) {
+            integrateSse(positions, velocities, count, dt, low, high);
+            return;
+        }
+#endif
+        integrateScalar(positions, velocities, count, dt, low, high);
+    }
+
+    void MovementSystem::setLevel(Simd::Level level) noexcept
+    {
+        _level = Simd::clamp(level);
+    }
+
+    Simd::Level MovementSystem::getLevel() const noexcept
+    {
+        return _level;
+    }
+
+    const MovementSystem::Bounds &MovementSystem::getBounds() const noexcept
+    {
+        return _bounds;
+    }
+} // namespace Ecs
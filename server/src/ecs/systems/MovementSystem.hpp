@@ -0,0 +1,95 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** MovementSystem
+*/
+
+#pragma once
+#include <cstddef>
+#include <vector>
+#include "Registry.hpp"
+#include "Simd.hpp"
+
+/**
+ * @namespace Ecs
+ * @brief Entity Component System namespace
+ */
+namespace Ecs
+{
+    /**
+     * @class MovementSystem
+     * @brief Integrates Velocity into Position and clamps positions to the playfield.
+     *
+     * The system walks a plain view of Position and Velocity, so it leaves both pools
+     * free to be owned by a group. Each tick, the matching components are gathered into
+     * SoA scratch arrays (`x`, `y`, `vx`, `vy`), a vectorized loop computes `p += v * dt`
+     * and clamps each axis, then the positions are scattered back.
+     *
+     * The kernel (AVX2, SSE or scalar) is picked at runtime from the CPU features.
+     */
+    class MovementSystem {
+      public:
+        /**
+         * @struct Bounds
+         * @brief Playfield rectangle positions are clamped to.
+         */
+        struct Bounds {
+            float minX = 0.f; ///> Left edge
+            float minY = 0.f; ///> Top edge
+            float maxX = 0.f; ///> Right edge
+            float maxY = 0.f; ///> Bottom edge
+        };
+
+        /**
+         * @brief Constructs the system with the best kernel of the running CPU.
+         * @param bounds Playfield rectangle
+         */
+        explicit MovementSystem(Bounds bounds) noexcept;
+
+        /**
+         * @brief Moves every entity owning a Position and a Velocity.
+         * @param registry Registry holding the entities
+         * @param dt Elapsed time, in seconds
+         */
+        void update(Registry &registry, float dt);
+
+        /**
+         * @brief Integrates one axis of positions and velocities, then clamps the positions.
+         *
+         * @param level Kernel to use (lowered to what the CPU supports)
+         * @param positions Positions on the axis
+         * @param velocities Velocities on the axis, parallel to positions
+         * @param count Number of entities
+         * @param dt Elapsed time, in seconds
+         * @param low Lowest position on the axis
+         * @param high Highest position on the axis
+         */
+        static void integrate(Simd::Level level, float *positions, const float *velocities, size_t count, float dt,
+            float low, float high) noexcept;
+
+        /**
+         * @brief Forces a kernel, for benchmarks and tests.
+         * @param level Requested kernel, lowered to what the CPU supports
+         */
+        void setLevel(Simd::Level level) noexcept;
+
+        /**
+         * @brief Gets the kernel in use.
+         */
+        Simd::Level getLevel() const noexcept;
+
+        /**
+         * @brief Gets the playfield rectangle.
+         */
+        const Bounds &getBounds() const noexcept;
+
+      private:
+        Bounds _bounds = {};                      ///> Playfield rectangle
+        Simd::Level _level = Simd::Level::Scalar; ///> Kernel in use
+        std::vector<float> _x = {};               ///> Gathered x positions
+        std::vector<float> _y = {};               ///> Gathered y positions
+        std::vector<float> _vx = {};              ///> Gathered x velocities
+        std::vector<float> _vy = {};              ///> Gathered y velocities
+    };
+} // namespace Ecs
@@ -0,0 +1,37 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Aabb
+*/
+
+#pragma once
+
+/**
+ * @namespace Physics
+ * @brief Collision detection for the entities of the ECS.
+ */
+namespace Physics
+{
+    /**
+     * @struct Aabb
+     * @brief Axis-aligned bounding box.
+     *
+     * Built from an entity's Position (top-left corner) and Collision (size).
+     */
+    struct Aabb {
+        float minX = 0.f; ///> Left edge
+        float minY = 0.f; ///> Top edge
+        float maxX = 0.f; ///> Right edge
+        float maxY = 0.f; ///> Bottom edge
+
+        /**
+         * @brief Checks if two boxes overlap. Touching edges count as an overlap.
+         * @param other Box to test against
+         */
+        constexpr bool overlaps(const Aabb &other) const noexcept
+        {
+            return minX <= other.maxX && other.minX <= maxX && minY <= other.maxY && other.minY <= maxY;
+        }
+    };
+} // namespace Physics
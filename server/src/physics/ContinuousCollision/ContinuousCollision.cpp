@@ -0,0 +1,152 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ContinuousCollision
+*/
+
+#include "ContinuousCollision.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include "Collision.hpp"
+#include "CollisionLayer.hpp"
+#include "FastMover.hpp"
+#include "NarrowPhase.hpp"
+#include "Position.hpp"
+#include "Velocity.hpp"
+
+namespace
+{
+    /**
+     * @brief Clips the [enter, exit] interval of a ray to one slab.
+     * @return false if the ray misses the slab
+     */
+    bool clipSlab(float origin, float direction, float min, float max, float &enter, float &exit) noexcept
+    {
+        if (direction == 0.f)
+            return min <= origin && origin <= max;
+        float near = (min - origin) / direction;
+        float far = (max - origin) / direction;
+
+        if (near > far)
+            std::swap(near, far);
+        enter = std::max(enter, near);
+        exit = std::min(exit, far);
+        return enter <= exit;
+    }
+}
+
+namespace Physics
+{
+    bool ContinuousCollision::sweep(const Aabb &moving, float dx, float dy, const Aabb &target, float &time) noexcept
+    {
+        float enter = 0.f;
+        float exit = 1.f;
+
+        if (!clipSlab(moving.minX, dx, target.minX - (moving.maxX - moving.minX), target.maxX, enter, exit)
+            || !clipSlab(moving.minY, dy, target.minY - (moving.maxY - moving.minY), target.maxY, enter, exit))
+            return false;
+        time = enter;
+        return true;
+    }
+
+    const std::vector<SweepHit> &ContinuousCollision::update(Ecs::Registry &registry, const UniformGrid &grid, float dt)
+    {
+        auto movers = registry.view<const Ecs::FastMover, const Ecs::Position, const Ecs::Velocity,
+            const Ecs::Collision, Ecs::Optional<const Ecs::CollisionLayer>>();
+
+        _hits.clear();
+        _visited = 0;
+        _stamps.resize(grid.getProxies().size(), 0);
+        movers.each([this, &grid, dt](Ecs::Entity entity, const Ecs::FastMover &, const Ecs::Position &pos,
+                         const Ecs::Velocity &vel, const Ecs::Collision &shape, const Ecs::CollisionLayer *layer) {
+            Ecs::CollisionLayer filter = layer ? *layer : Ecs::CollisionLayer{};
+            Proxy mover = {
+                entity, {pos.x, pos.y, pos.x + shape.width, pos.y + shape.height}, filter.layer, filter.mask};
+            size_t first = _hits.size();
+
+            sweepMover(grid, mover, vel.vx * dt, vel.vy * dt);
+            std::sort(_hits.begin() + static_cast<std::ptrdiff_t>(first), _hits.end(),
+                [](const SweepHit &lhs, const SweepHit &rhs) {
+                    return lhs.time < rhs.time;
+                });
+        });
+        return _hits;
+    }
+
+    const std::vector<SweepHit> &ContinuousCollision::getHits() const noexcept
+    {
+        return _hits;
+    }
+
+    size_t ContinuousCollision::getVisitedCells() const noexcept
+    {
+        return _visited;
+    }
+
+    void ContinuousCollision::sweepMover(const UniformGrid &grid, const Proxy &mover, float dx, float dy)
+    {
+        if (++_stamp == 0) {
+            std::fill(_stamps.begin(), _stamps.end(), 0);
+            _stamp = 1;
+        }
+        const Aabb &world = grid.getWorld();
+        float size = grid.getCellSize();
+        float x = mover.box.minX;
+        float y = mover.box.minY;
+        size_t spanColumns = static_cast<size_t>((mover.box.maxX - mover.box.minX) / size) + 2;
+        size_t spanRows = static_cast<size_t>((mover.box.maxY - mover.box.minY) / size) + 2;
+        size_t column = grid.columnOf(x);
+        size_t row = grid.rowOf(y);
+        size_t lastColumn = grid.columnOf(x + dx);
+        size_t lastRow = grid.rowOf(y + dy);
+        constexpr float never = std::numeric_limits<float>::infinity();
+        float nextX = dx > 0.f ? (world.minX + static_cast<float>(column + 1) * size - x) / dx
+            : dx < 0.f         ? (world.minX + static_cast<float>(column) * size - x) / dx
+                               : never;
+        float nextY = dy > 0.f ? (world.minY + static_cast<float>(row + 1) * size - y) / dy
+            : dy < 0.f         ? (world.minY + static_cast<float>(row) * size - y) / dy
+                               : never;
+        float stepX = dx != 0.f ? size / std::fabs(dx) : never;
+        float stepY = dy != 0.f ? size / std::fabs(dy) : never;
+
+        testCells(grid, mover, dx, dy, column, row, spanColumns, spanRows);
+        while (column != lastColumn || row != lastRow) {
+            if (row == lastRow || (column != lastColumn && nextX < nextY)) {
+                column = dx > 0.f ? column + 1 : column - 1;
+                nextX += stepX;
+            } else {
+                row = dy > 0.f ? row + 1 : row - 1;
+                nextY += stepY;
+            }
+            testCells(grid, mover, dx, dy, column, row, spanColumns, spanRows);
+        }
+    }
+
+    void ContinuousCollision::testCells(const UniformGrid &grid, const Proxy &mover, float dx, float dy,
+        size_t column, size_t row, size_t columns, size_t rows)
+    {
+        const std::vector<Proxy> &proxies = grid.getProxies();
+        size_t lastColumn = std::min(column + columns, grid.getColumns());
+        size_t lastRow = std::min(row + rows, grid.getRows());
+
+        for (size_t cellRow = row; cellRow < lastRow; ++cellRow) {
+            for (size_t cellColumn = column; cellColumn < lastColumn; ++cellColumn) {
+                _visited++;
+                for (uint32_t index : grid.getCell(cellColumn, cellRow)) {
+                    const Proxy &target = proxies[index];
+                    float time = 0.f;
+
+                    if (_stamps[index] == _stamp)
+                        continue;
+                    _stamps[index] = _stamp;
+                    if (target.entity != mover.entity && NarrowPhase::canCollide(mover, target)
+                        && sweep(mover.box, dx, dy, target.box, time))
+                        _hits.push_back({mover.entity, target.entity, time});
+                }
+            }
+        }
+    }
+} // namespace Physics
@@ -0,0 +1,99 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ContinuousCollision
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "UniformGrid.hpp"
+
+/**
+ * @namespace Physics
+ * @brief Collision detection for the entities of the ECS.
+ */
+namespace Physics
+{
+    /**
+     * @struct SweepHit
+     * @brief First contact of a fast entity with a box along its motion.
+     */
+    struct SweepHit {
+        Ecs::Entity mover{};  ///> Entity tagged FastMover
+        Ecs::Entity target{}; ///> Entity hit
+        float time = 0.f;     ///> Fraction of the step at the contact, in [0, 1]
+    };
+
+    /**
+     * @class ContinuousCollision
+     * @brief Swept collision tests for entities tagged FastMover.
+     *
+     * The motion of a fast entity during the tick (Velocity * dt, from its Position) is
+     * tested against the boxes of the uniform grid, so it cannot tunnel through a box
+     * thinner than its step. Only the cells along the motion segment are visited, with
+     * a grid walk widened by the size of the mover.
+     *
+     * Run it after the grid update and before MovementSystem: the grid and the start of
+     * the segments must both hold the positions of the beginning of the tick.
+     */
+    class ContinuousCollision {
+      public:
+        /**
+         * @brief Computes when a moving box first touches a static box.
+         *
+         * Ray against the target grown by the size of the moving box (slab method).
+         * Boxes already overlapping hit at time 0.
+         *
+         * @param moving Box at the start of the step
+         * @param dx Horizontal motion during the step
+         * @param dy Vertical motion during the step
+         * @param target Static box
+         * @param time Receives the fraction of the step at the contact
+         * @return true if the boxes touch during the step
+         */
+        static bool sweep(const Aabb &moving, float dx, float dy, const Aabb &target, float &time) noexcept;
+
+        /**
+         * @brief Sweeps every fast entity against the boxes of the grid.
+         * @param registry Registry holding the entities
+         * @param grid Grid updated from the same registry
+         * @param dt Duration of the tick
+         * @return Hits of this tick, grouped by mover and sorted by time, also available through getHits()
+         */
+        const std::vector<SweepHit> &update(Ecs::Registry &registry, const UniformGrid &grid, float dt);
+
+        /**
+         * @brief Gets the hits found by the last update.
+         */
+        const std::vector<SweepHit> &getHits() const noexcept;
+
+        /**
+         * @brief Gets the number of grid cells visited by the last update.
+         */
+        size_t getVisitedCells() const noexcept;
+
+      private:
+        /**
+         * @brief Sweeps one fast entity and appends its hits.
+         * @param grid Updated grid
+         * @param mover Shape of the fast entity at the start of the step
+         * @param dx Horizontal motion during the step
+         * @param dy Vertical motion during the step
+         */
+        void sweepMover(const UniformGrid &grid, const Proxy &mover, float dx, float dy);
+
+        /**
+         * @brief Tests the proxies of a block of cells against a moving proxy.
+         */
+        void testCells(const UniformGrid &grid, const Proxy &mover, float dx, float dy, size_t column, size_t row,
+            size_t columns, size_t rows);
+
+        std::vector<SweepHit> _hits = {};   ///> Hits of the last update
+        std::vector<uint32_t> _stamps = {}; ///> Last mover that tested each proxy
+        uint32_t _stamp = 0;                ///> Number of movers swept, used as the current stamp
+        size_t _visited = 0;                ///> Cells visited by the last update
+    };
+} // namespace Physics
@@ -0,0 +1,162 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** NarrowPhase
+*/
+
+#include "NarrowPhase.hpp"
+#include <bit>
+
+namespace
+{
+    using Boxes = Physics::NarrowPhase::Boxes;
+
+    size_t overlapScalar(const Boxes &a, const Boxes &b, size_t begin, size_t count, uint32_t *hits) noexcept
+    {
+        size_t found = 0;
+
+        for (size_t i = begin; i < count; ++i) {
+            hits[found] = static_cast<uint32_t>(i);
+            found += a.minX[i] <= b.maxX[i] && b.minX[i] <= a.maxX[i] && a.minY[i] <= b.maxY[i]
+                && b.minY[i] <= a.maxY[i];
+        }
+        return found;
+    }
+
+#if SIMD_X86
+    SIMD_TARGET("sse4.1")
+    size_t overlapSse(const Boxes &a, const Boxes &b, size_t begin, size_t count, uint32_t *hits) noexcept
+    {
+        size_t found = 0;
+        size_t i = begin;
+
+        for (; i + 4 <= count; i += 4) {
+            __m128 x = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(&a.minX[i]), _mm_loadu_ps(&b.maxX[i])),
+                _mm_cmple_ps(_mm_loadu_ps(&b.minX[i]), _mm_loadu_ps(&a.maxX[i])));
+            __m128 y = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(&a.minY[i]), _mm_loadu_ps(&b.maxY[i])),
+                _mm_cmple_ps(_mm_loadu_ps(&b.minY[i]), _mm_loadu_ps(&a.maxY[i])));
+
+            for (auto bits = static_cast<unsigned>(_mm_movemask_ps(_mm_and_ps(x, y))); bits; bits &= bits - 1)
+                hits[found++] = static_cast<uint32_t>(i) + static_cast<uint32_t>(std::countr_zero(bits));
+        }
+        return found + overlapScalar(a, b, i, count, hits + found);
+    }
+
+    SIMD_TARGET("avx2")
+    size_t overlapAvx2(const Boxes &a, const Boxes &b, size_t count, uint32_t *hits) noexcept
+    {
+        size_t found = 0;
+        size_t i = 0;
+
+        for (; i + 8 <= count; i += 8) {
+            __m256 x =
+                _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(&a.minX[i]), _mm256_loadu_ps(&b.maxX[i]), _CMP_LE_OQ),
+                    _mm256_cmp_ps(_mm256_loadu_ps(&b.minX[i]), _mm256_loadu_ps(&a.maxX[i]), _CMP_LE_OQ));
+            __m256 y =
+                _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(&a.minY[i]), _mm256_loadu_ps(&b.maxY[i]), _CMP_LE_OQ),
+                    _mm256_cmp_ps(_mm256_loadu_ps(&b.minY[i]), _mm256_loadu_ps(&a.maxY[i]), _CMP_LE_OQ));
+
+            for (auto bits = static_cast<unsigned>(_mm256_movemask_ps(_mm256_and_ps(x, y))); bits; bits &= bits - 1)
+                hits[found++] = static_cast<uint32_t>(i) + static_cast<uint32_t>(std::countr_zero(bits));
+        }
+        return found + overlapSse(a, b, i, count, hits + found);
+    }
+#endif
+}
+
+namespace Physics
+{
+    void NarrowPhase::Boxes::push(const Aabb &box)
+    {
+        minX.push_back(box.minX);
+        minY.push_back(box.minY);
+        maxX.push_back(box.maxX);
+        maxY.push_back(box.maxY);
+    }
+
+    void NarrowPhase::Boxes::clear() noexcept
+    {
+        minX.clear();
+        minY.clear();
+        maxX.clear();
+        maxY.clear();
+    }
+
+    NarrowPhase::NarrowPhase() noexcept : _level(Simd::detect())
+    {
+    }
+
+    const std::vector<Contact> &NarrowPhase::update(const IBroadPhase &broadPhase)
+    {
+        const std::vector<Proxy> &proxies = broadPhase.getProxies();
+        const std::vector<ProxyPair> &pairs = broadPhase.getPairs();
+
+        _first.clear();
+        _second.clear();
+        _kept.clear();
+        _contacts.clear();
+        for (size_t i = 0; i < pairs.size(); ++i) {
+            const Proxy &first = proxies[pairs[i].first];
+            const Proxy &second = proxies[pairs[i].second];
+
+            if (!canCollide(first, second))
+                continue;
+            _first.push(first.box);
+            _second.push(second.box);
+            _kept.push_back(static_cast<uint32_t>(i));
+        }
+        _filtered = pairs.size() - _kept.size();
+        overlap(_level, _first, _second, _hits);
+        _contacts.reserve(_hits.size());
+        for (uint32_t hit : _hits) {
+            const ProxyPair &pair = pairs[_kept[hit]];
+
+            _contacts.push_back({proxies[pair.first].entity, proxies[pair.second].entity});
+        }
+        return _contacts;
+    }
+
+    const std::vector<Contact> &NarrowPhase::getContacts() const noexcept
+    {
+        return _contacts;
+    }
+
+    size_t NarrowPhase::getFiltered() const noexcept
+    {
+        return _filtered;
+    }
+
+    bool NarrowPhase::canCollide(const Proxy &first, const Proxy &second) noexcept
+    {
+        return (first.layer & second.mask) && (second.layer & first.mask);
+    }
+
+    void NarrowPhase::overlap(Simd::Level level, const Boxes &first, const Boxes &second, std::vector<uint32_t> &hits)
+    {
+        [[maybe_unused]] const Simd::Level kernel = Simd::clamp(level);
+        size_t count = first.minX.size();
+        size_t found = 0;
+
+        hits.resize(count);
+#if SIMD_X86
+        if (kernel == Simd::Level::Avx2)
+            found = overlapAvx2(first, second, count, hits.data());
+        else if (kernel == Simd::Level::Sse)
+            found = overlapSse(first, second, 0, count, hits.data());
+        else
+#endif
+            found = overlapScalar(first, second, 0, count, hits.data());
+        hits.resize(found);
+    }
+
+    void NarrowPhase::setLevel(Simd::Level level) noexcept
+    {
+        _level = Simd::clamp(level);
+    }
+
+    Simd::Level NarrowPhase::getLevel() const noexcept
+    {
+        return _level;
+    }
+} // namespace Physics
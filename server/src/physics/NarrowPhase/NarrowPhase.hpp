@@ -0,0 +1,118 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** NarrowPhase
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "IBroadPhase.hpp"
+#include "Simd.hpp"
+
+/**
+ * @namespace Physics
+ * @brief Collision detection for the entities of the ECS.
+ */
+namespace Physics
+{
+    /**
+     * @struct Contact
+     * @brief Two entities whose collision boxes overlap.
+     */
+    struct Contact {
+        Ecs::Entity first{};  ///> First entity
+        Ecs::Entity second{}; ///> Second entity
+    };
+
+    /**
+     * @class NarrowPhase
+     * @brief Turns the candidate pairs of a broad-phase into a list of contacts.
+     *
+     * Pairs whose CollisionLayer filters reject each other are dropped first, with one
+     * bitwise test per pair. The remaining boxes are gathered into structure-of-arrays
+     * streams and tested 8 pairs per iteration with AVX2 (4 with SSE, or a scalar loop),
+     * the instruction set being chosen at runtime.
+     */
+    class NarrowPhase {
+      public:
+        /**
+         * @struct Boxes
+         * @brief Boxes stored as one float stream per edge.
+         */
+        struct Boxes {
+            std::vector<float> minX = {}; ///> Left edges
+            std::vector<float> minY = {}; ///> Top edges
+            std::vector<float> maxX = {}; ///> Right edges
+            std::vector<float> maxY = {}; ///> Bottom edges
+
+            /**
+             * @brief Appends a box to the streams.
+             */
+            void push(const Aabb &box);
+
+            /**
+             * @brief Empties the streams, keeping their capacity.
+             */
+            void clear() noexcept;
+        };
+
+        /**
+         * @brief Constructs a narrow-phase using the best instruction set of the CPU.
+         */
+        NarrowPhase() noexcept;
+
+        /**
+         * @brief Tests the pairs found by a broad-phase in its last update.
+         * @param broadPhase Updated broad-phase
+         * @return Contacts of this tick, also available through getContacts()
+         */
+        const std::vector<Contact> &update(const IBroadPhase &broadPhase);
+
+        /**
+         * @brief Gets the contacts found by the last update.
+         */
+        const std::vector<Contact> &getContacts() const noexcept;
+
+        /**
+         * @brief Gets the number of pairs dropped by the layer filter in the last update.
+         */
+        size_t getFiltered() const noexcept;
+
+        /**
+         * @brief Checks if the layer filters of two proxies let them collide.
+         */
+        static bool canCollide(const Proxy &first, const Proxy &second) noexcept;
+
+        /**
+         * @brief Tests boxes two by two, first[i] against second[i].
+         * @param level Instruction set to use, lowered to what the CPU supports
+         * @param first First box of each pair
+         * @param second Second box of each pair, with as many boxes as first
+         * @param hits Receives the indices of the overlapping pairs, in increasing order
+         */
+        static void overlap(Simd::Level level, const Boxes &first, const Boxes &second, std::vector<uint32_t> &hits);
+
+        /**
+         * @brief Forces the instruction set, lowered to what the CPU supports.
+         * @param level Preferred level
+         */
+        void setLevel(Simd::Level level) noexcept;
+
+        /**
+         * @brief Gets the instruction set used by update().
+         */
+        Simd::Level getLevel() const noexcept;
+
+      private:
+        Simd::Level _level;                  ///> Instruction set of the overlap kernel
+        Boxes _first = {};                   ///> First boxes of the pairs kept by the filter
+        Boxes _second = {};                  ///> Second boxes of the pairs kept by the filter
+        std::vector<uint32_t> _kept = {};    ///> Broad-phase pair index of each tested pair
+        std::vector<uint32_t> _hits = {};    ///> Tested pairs that overlap
+        std::vector<Contact> _contacts = {}; ///> Contacts of the last update
+        size_t _filtered = 0;                ///> Pairs dropped by the layer filter
+    };
+} // namespace Physics
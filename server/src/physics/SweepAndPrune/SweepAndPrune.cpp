@@ -0,0 +1,89 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** SweepAndPrune
+*/
+
+#include "SweepAndPrune.hpp"
+#include <algorithm>
+
+namespace Physics
+{
+    const std::vector<uint32_t> &SweepAndPrune::getOrder() const noexcept
+    {
+        return _order;
+    }
+
+    size_t SweepAndPrune::getShifts() const noexcept
+    {
+        return _shifts;
+    }
+
+    void SweepAndPrune::sort()
+    {
+        for (size_t i = 0; i < _proxies.size(); ++i) {
+            size_t index = _proxies[i].entity.index();
+
+            if (index >= _slots.size())
+                _slots.resize(index + 1, NO_PROXY);
+            _slots[index] = static_cast<uint32_t>(i);
+        }
+        _order.clear();
+        _placed.assign(_proxies.size(), 0);
+        for (const Ecs::Entity &entity : _sorted) {
+            uint32_t slot = entity.index() < _slots.size() ? _slots[entity.index()] : NO_PROXY;
+
+            if (slot != NO_PROXY && _proxies[slot].entity == entity && !_placed[slot]) {
+                _order.push_back(slot);
+                _placed[slot] = 1;
+            }
+        }
+        auto byLeftEdge = [this](uint32_t lhs, uint32_t rhs) {
+            return _proxies[lhs].box.minX < _proxies[rhs].box.minX;
+        };
+        size_t kept = _order.size();
+
+        _shifts = 0;
+        for (size_t i = 1; i < kept; ++i) {
+            uint32_t proxy = _order[i];
+            size_t pos = i;
+
+            for (; pos > 0 && byLeftEdge(proxy, _order[pos - 1]); --pos)
+                _order[pos] = _order[pos - 1];
+            _order[pos] = proxy;
+            _shifts += i - pos;
+        }
+        for (size_t i = 0; i < _proxies.size(); ++i)
+            if (!_placed[i])
+                _order.push_back(static_cast<uint32_t>(i));
+        auto middle = _order.begin() + static_cast<std::ptrdiff_t>(kept);
+
+        std::sort(middle, _order.end(), byLeftEdge);
+        std::inplace_merge(_order.begin(), middle, _order.end(), byLeftEdge);
+        for (const Proxy &proxy : _proxies)
+            _slots[proxy.entity.index()] = NO_PROXY;
+        _sorted.clear();
+        for (uint32_t proxy : _order)
+            _sorted.push_back(_proxies[proxy].entity);
+    }
+
+    size_t SweepAndPrune::computePairs()
+    {
+        size_t tests = 0;
+
+        sort();
+        for (size_t i = 0; i < _order.size(); ++i) {
+            const Aabb &box = _proxies[_order[i]].box;
+
+            for (size_t j = i + 1; j < _order.size() && _proxies[_order[j]].box.minX <= box.maxX; ++j) {
+                const Aabb &other = _proxies[_order[j]].box;
+
+                tests++;
+                if (box.minY <= other.maxY && other.minY <= box.maxY)
+                    _pairs.push_back({std::min(_order[i], _order[j]), std::max(_order[i], _order[j])});
+            }
+        }
+        return tests;
+    }
+} // namespace Physics
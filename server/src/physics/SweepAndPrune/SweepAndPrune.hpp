@@ -0,0 +1,63 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** SweepAndPrune
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "ABroadPhase.hpp"
+
+/**
+ * @namespace Physics
+ * @brief Collision detection for the entities of the ECS.
+ */
+namespace Physics
+{
+    /**
+     * @class SweepAndPrune
+     * @brief Broad-phase sorting the proxies along the x axis and sweeping over them.
+     *
+     * The order of the previous tick is kept by entity, so with coherent motion the
+     * proxies are almost sorted already and an insertion sort restores the order in
+     * close to linear time. Entities appearing in the tick are sorted on their own and
+     * merged in. The sweep then pairs every proxy with the following ones until their
+     * left edge passes its right edge, and only keeps the pairs overlapping on y.
+     */
+    class SweepAndPrune : public ABroadPhase {
+      public:
+        /**
+         * @brief Gets the proxies sorted by left edge in the last update.
+         * @return Indices into getProxies()
+         */
+        const std::vector<uint32_t> &getOrder() const noexcept;
+
+        /**
+         * @brief Gets the number of moves the insertion sort needed in the last update.
+         *
+         * Stays close to the number of proxies while motion is coherent.
+         */
+        size_t getShifts() const noexcept;
+
+      protected:
+        size_t computePairs() override;
+
+      private:
+        /** @brief Value of _slots for entity indices without a proxy */
+        static constexpr uint32_t NO_PROXY = UINT32_MAX;
+
+        /**
+         * @brief Rebuilds _order from the order of the previous tick, then sorts it.
+         */
+        void sort();
+
+        std::vector<uint32_t> _order = {};     ///> Proxy indices sorted by left edge
+        std::vector<Ecs::Entity> _sorted = {}; ///> Entities of _order, kept for the next tick
+        std::vector<uint32_t> _slots = {};     ///> Proxy index of each entity index (NO_PROXY if none)
+        std::vector<uint8_t> _placed = {};     ///> Proxies already placed in _order
+        size_t _shifts = 0;                    ///> Moves of the last insertion sort
+    };
+} // namespace Physics
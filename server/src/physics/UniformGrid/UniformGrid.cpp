@@ -0,0 +1,129 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** UniformGrid
+*/
+
+#include "UniformGrid.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Physics
+{
+    UniformGrid::UniformGrid(const Aabb &world, float cellSize) : _world(world)
+    {
+        setCellSize(cellSize);
+    }
+
+    void UniformGrid::setCellSize(float cellSize)
+    {
+        if (!(cellSize > 0.f))
+            throw std::invalid_argument("{UniformGrid::setCellSize} Cell size must be positive");
+        double side = static_cast<double>(cellSize);
+        double columns = std::max(std::ceil(static_cast<double>(_world.maxX - _world.minX) / side), 1.0);
+        double rows = std::max(std::ceil(static_cast<double>(_world.maxY - _world.minY) / side), 1.0);
+
+        if (columns * rows > static_cast<double>(MAX_CELLS))
+            throw std::invalid_argument("{UniformGrid::setCellSize} Too many cells for this world");
+        _cellSize = cellSize;
+        _inverseCellSize = 1.f / cellSize;
+        _columns = static_cast<size_t>(columns);
+        _rows = static_cast<size_t>(rows);
+        _cellStart.assign(_columns * _rows + 1, 0);
+        _entries.clear();
+    }
+
+    float UniformGrid::getCellSize() const noexcept
+    {
+        return _cellSize;
+    }
+
+    const Aabb &UniformGrid::getWorld() const noexcept
+    {
+        return _world;
+    }
+
+    size_t UniformGrid::getColumns() const noexcept
+    {
+        return _columns;
+    }
+
+    size_t UniformGrid::getRows() const noexcept
+    {
+        return _rows;
+    }
+
+    size_t UniformGrid::columnOf(float x) const noexcept
+    {
+        float cell = (x - _world.minX) * _inverseCellSize;
+
+        if (!(cell > 0.f))
+            return 0;
+        return cell >= static_cast<float>(_columns) ? _columns - 1 : static_cast<size_t>(cell);
+    }
+
+    size_t UniformGrid::rowOf(float y) const noexcept
+    {
+        float cell = (y - _world.minY) * _inverseCellSize;
+
+        if (!(cell > 0.f))
+            return 0;
+        return cell >= static_cast<float>(_rows) ? _rows - 1 : static_cast<size_t>(cell);
+    }
+
+    std::span<const uint32_t> UniformGrid::getCell(size_t column, size_t row) const noexcept
+    {
+        if (column >= _columns || row >= _rows)
+            return {};
+        size_t cell = row * _columns + column;
+
+        return std::span<const uint32_t>(_entries).subspan(_cellStart[cell], _cellStart[cell + 1] - _cellStart[cell]);
+    }
+
+    size_t UniformGrid::computePairs()
+    {
+        _ranges.resize(_proxies.size());
+        std::fill(_cellStart.begin(), _cellStart.end(), 0);
+        for (size_t i = 0; i < _proxies.size(); ++i) {
+            const Aabb &box = _proxies[i].box;
+            CellRange &range = _ranges[i];
+
+            range = {static_cast<uint32_t>(columnOf(box.minX)), static_cast<uint32_t>(rowOf(box.minY)),
+                static_cast<uint32_t>(columnOf(box.maxX)), static_cast<uint32_t>(rowOf(box.maxY))};
+            for (size_t row = range.minRow; row <= range.maxRow; ++row)
+                for (size_t column = range.minColumn; column <= range.maxColumn; ++column)
+                    _cellStart[row * _columns + column]++;
+        }
+        for (size_t cell = 1; cell < _cellStart.size(); ++cell)
+            _cellStart[cell] += _cellStart[cell - 1];
+        _entries.resize(_cellStart.back());
+        for (size_t i = _proxies.size(); i-- > 0;) {
+            const CellRange &range = _ranges[i];
+
+            for (size_t row = range.minRow; row <= range.maxRow; ++row)
+                for (size_t column = range.minColumn; column <= range.maxColumn; ++column)
+                    _entries[--_cellStart[row * _columns + column]] = static_cast<uint32_t>(i);
+        }
+        size_t tests = 0;
+
+        for (size_t cell = 0; cell + 1 < _cellStart.size(); ++cell) {
+            size_t column = cell % _columns;
+            size_t row = cell / _columns;
+
+            for (uint32_t a = _cellStart[cell]; a < _cellStart[cell + 1]; ++a) {
+                for (uint32_t b = a + 1; b < _cellStart[cell + 1]; ++b) {
+                    const CellRange &first = _ranges[_entries[a]];
+                    const CellRange &second = _ranges[_entries[b]];
+
+                    tests++;
+                    if (std::max(first.minColumn, second.minColumn) == column
+                        && std::max(first.minRow, second.minRow) == row)
+                        _pairs.push_back({_entries[a], _entries[b]});
+                }
+            }
+        }
+        return tests;
+    }
+} // namespace Physics
@@ -0,0 +1,117 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** UniformGrid
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "ABroadPhase.hpp"
+
+/**
+ * @namespace Physics
+ * @brief Collision detection for the entities of the ECS.
+ */
+namespace Physics
+{
+    /**
+     * @class UniformGrid
+     * @brief Broad-phase binning proxies into a flat grid of square cells.
+     *
+     * The grid is rebuilt every tick with a counting sort: one pass counts the
+     * proxies of each cell, a prefix sum turns the counts into offsets, and a
+     * second pass scatters proxy indices into one flat array. Cells are ranges of
+     * that array, so the build performs no per-cell allocation, and every buffer
+     * keeps its capacity between ticks.
+     *
+     * A proxy spanning several cells is stored in each of them. A pair is only
+     * emitted by the first cell both proxies share, so there are no duplicates.
+     * Proxies outside the world rectangle are clamped to the border cells.
+     */
+    class UniformGrid : public ABroadPhase {
+      public:
+        /** @brief Maximum number of cells of a grid */
+        static constexpr size_t MAX_CELLS = size_t{1} << 22;
+
+        /**
+         * @brief Constructs a grid covering a world rectangle.
+         * @param world Area covered by the cells
+         * @param cellSize Side of a cell, ideally about the size of the common shapes
+         * @throws std::invalid_argument if the cell size is not positive or the grid is too large
+         */
+        UniformGrid(const Aabb &world, float cellSize);
+
+        /**
+         * @brief Changes the side of the cells, effective from the next update.
+         * @param cellSize Side of a cell
+         * @throws std::invalid_argument if the cell size is not positive or the grid is too large
+         */
+        void setCellSize(float cellSize);
+
+        /**
+         * @brief Gets the side of the cells.
+         */
+        float getCellSize() const noexcept;
+
+        /**
+         * @brief Gets the area covered by the cells.
+         */
+        const Aabb &getWorld() const noexcept;
+
+        /**
+         * @brief Gets the number of cell columns.
+         */
+        size_t getColumns() const noexcept;
+
+        /**
+         * @brief Gets the number of cell rows.
+         */
+        size_t getRows() const noexcept;
+
+        /**
+         * @brief Gets the column containing an x coordinate, clamped to the grid.
+         */
+        size_t columnOf(float x) const noexcept;
+
+        /**
+         * @brief Gets the row containing a y coordinate, clamped to the grid.
+         */
+        size_t rowOf(float y) const noexcept;
+
+        /**
+         * @brief Gets the proxies overlapping a cell in the last update.
+         * @param column Cell column
+         * @param row Cell row
+         * @return Indices into getProxies(), in increasing order
+         */
+        std::span<const uint32_t> getCell(size_t column, size_t row) const noexcept;
+
+      protected:
+        size_t computePairs() override;
+
+      private:
+        /**
+         * @struct CellRange
+         * @brief Cells overlapped by a proxy (inclusive bounds).
+         */
+        struct CellRange {
+            uint32_t minColumn = 0; ///> First column
+            uint32_t minRow = 0;    ///> First row
+            uint32_t maxColumn = 0; ///> Last column
+            uint32_t maxRow = 0;    ///> Last row
+        };
+
+        Aabb _world = {};                      ///> Area covered by the cells
+        float _cellSize = 0.f;                 ///> Side of a cell
+        float _inverseCellSize = 0.f;          ///> 1 / _cellSize
+        size_t _columns = 0;                   ///> Number of columns
+        size_t _rows = 0;                      ///> Number of rows
+        std::vector<CellRange> _ranges = {};   ///> Cells overlapped by each proxy
+        std::vector<uint32_t> _cellStart = {}; ///> Offset of each cell in _entries (one extra for the end)
+        std::vector<uint32_t> _entries = {};   ///> Proxy indices, grouped by cell
+    };
+} // namespace Physics
@@ -0,0 +1,51 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ABroadPhase
+*/
+
+#include "ABroadPhase.hpp"
+#include "Collision.hpp"
+#include "CollisionLayer.hpp"
+#include "Position.hpp"
+
+namespace Physics
+{
+    void ABroadPhase::update(Ecs::Registry &registry)
+    {
+        auto shapes =
+            registry.view<const Ecs::Position, const Ecs::Collision, Ecs::Optional<const Ecs::CollisionLayer>>();
+
+        _proxies.clear();
+        _proxies.reserve(shapes.sizeHint());
+        shapes.each([this](Ecs::Entity entity, const Ecs::Position &pos, const Ecs::Collision &shape,
+                         const Ecs::CollisionLayer *layer) {
+            Ecs::CollisionLayer filter = layer ? *layer : Ecs::CollisionLayer{};
+
+            _proxies.push_back(
+                {entity, {pos.x, pos.y, pos.x + shape.width, pos.y + shape.height}, filter.layer, filter.mask});
+        });
+        _pairs.clear();
+        _stats.tests = computePairs();
+        _stats.proxies = _proxies.size();
+        _stats.pairs = _pairs.size();
+        _stats.ticks++;
+        _stats.totalPairs += _pairs.size();
+    }
+
+    const std::vector<Proxy> &ABroadPhase::getProxies() const noexcept
+    {
+        return _proxies;
+    }
+
+    const std::vector<ProxyPair> &ABroadPhase::getPairs() const noexcept
+    {
+        return _pairs;
+    }
+
+    const BroadPhaseStats &ABroadPhase::getStats() const noexcept
+    {
+        return _stats;
+    }
+} // namespace Physics
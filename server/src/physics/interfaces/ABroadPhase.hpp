@@ -0,0 +1,50 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ABroadPhase
+*/
+
+#pragma once
+#include <vector>
+#include "IBroadPhase.hpp"
+
+/**
+ * @namespace Physics
+ * @brief Collision detection for the entities of the ECS.
+ */
+namespace Physics
+{
+    /**
+     * @class ABroadPhase
+     * @brief Abstract base of the broad-phases: proxy collection, output and statistics.
+     *
+     * Derived classes only implement computePairs(), which reads _proxies and
+     * fills _pairs.
+     */
+    class ABroadPhase : public IBroadPhase {
+      public:
+        /**
+         * @brief Collects the proxies, calls computePairs() and updates the statistics.
+         * @param registry Registry holding the entities
+         */
+        void update(Ecs::Registry &registry) override;
+
+        const std::vector<Proxy> &getProxies() const noexcept override;
+
+        const std::vector<ProxyPair> &getPairs() const noexcept override;
+
+        const BroadPhaseStats &getStats() const noexcept override;
+
+      protected:
+        /**
+         * @brief Fills _pairs from _proxies.
+         * @return Number of candidate pairs examined
+         */
+        virtual size_t computePairs() = 0;
+
+        std::vector<Proxy> _proxies = {};   ///> Shapes of the current tick
+        std::vector<ProxyPair> _pairs = {}; ///> Candidate pairs of the current tick
+        BroadPhaseStats _stats = {};        ///> Counters
+    };
+} // namespace Physics
@@ -0,0 +1,100 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** IBroadPhase
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Aabb.hpp"
+#include "Entity.hpp"
+#include "Registry.hpp"
+
+/**
+ * @namespace Physics
+ * @brief Collision detection for the entities of the ECS.
+ */
+namespace Physics
+{
+    /**
+     * @struct Proxy
+     * @brief Collision shape of one entity, as seen by the broad-phase.
+     */
+    struct Proxy {
+        Ecs::Entity entity{};       ///> Entity owning the shape
+        Aabb box = {};              ///> World-space bounding box
+        uint32_t layer = 1;         ///> CollisionLayer::layer of the entity
+        uint32_t mask = UINT32_MAX; ///> CollisionLayer::mask of the entity
+    };
+
+    /**
+     * @struct ProxyPair
+     * @brief Candidate collision between two proxies, first < second.
+     */
+    struct ProxyPair {
+        uint32_t first = 0;  ///> Index of the first proxy
+        uint32_t second = 0; ///> Index of the second proxy
+
+        bool operator==(const ProxyPair &other) const noexcept = default;
+    };
+
+    /**
+     * @struct BroadPhaseStats
+     * @brief Counters of a broad-phase, to compare implementations and tune them.
+     */
+    struct BroadPhaseStats {
+        size_t proxies = 0;    ///> Proxies in the last tick
+        size_t tests = 0;      ///> Candidate pairs examined in the last tick
+        size_t pairs = 0;      ///> Pairs emitted in the last tick
+        size_t ticks = 0;      ///> Number of updates
+        size_t totalPairs = 0; ///> Pairs emitted since the first update
+
+        /**
+         * @brief Average number of pairs emitted per tick.
+         */
+        double averagePairs() const noexcept
+        {
+            return ticks ? static_cast<double>(totalPairs) / static_cast<double>(ticks) : 0.0;
+        }
+    };
+
+    /**
+     * @interface IBroadPhase
+     * @brief Finds the pairs of entities whose bounding boxes may overlap.
+     *
+     * Every broad-phase collects the entities owning a Position and a Collision,
+     * then emits the same output: a proxy list and pairs of proxy indices, so the
+     * narrow-phase does not depend on the implementation picked for a room.
+     */
+    class IBroadPhase {
+      public:
+        /**
+         * @brief Virtual destructor.
+         */
+        virtual ~IBroadPhase() = default;
+
+        /**
+         * @brief Collects the proxies of a registry and computes the candidate pairs.
+         * @param registry Registry holding the entities
+         */
+        virtual void update(Ecs::Registry &registry) = 0;
+
+        /**
+         * @brief Proxies collected by the last update.
+         */
+        virtual const std::vector<Proxy> &getProxies() const noexcept = 0;
+
+        /**
+         * @brief Candidate pairs computed by the last update, without duplicates.
+         */
+        virtual const std::vector<ProxyPair> &getPairs() const noexcept = 0;
+
+        /**
+         * @brief Counters of the broad-phase.
+         */
+        virtual const BroadPhaseStats &getStats() const noexcept = 0;
+    };
+} // namespace Physics
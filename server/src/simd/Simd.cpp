@@ -0,0 +1,33 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Simd
+*/
+
+#include "Simd.hpp"
+#include <algorithm>
+
+namespace Simd
+{
+    Level detect() noexcept
+    {
+        static const Level level = [] {
+#if SIMD_X86
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2"))
+                return Level::Avx2;
+            if (__builtin_cpu_supports("sse4.1"))
+                return Level::Sse;
+#endif
+            return Level::Scalar;
+        }();
+
+        return level;
+    }
+
+    Level clamp(Level requested) noexcept
+    {
+        return std::min(requested, detect());
+    }
+} // namespace Simd
@@ -0,0 +1,54 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** Simd
+*/
+
+#pragma once
+
+/**
+ * @brief Defined to 1 when x86 SIMD kernels can be compiled with per-function targets.
+ *
+ * Kernels marked with SIMD_TARGET are built for their instruction set whatever the
+ * global compiler flags, and must only run after Simd::detect() reported support.
+ */
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #define SIMD_X86 1
+    #define SIMD_TARGET(isa) __attribute__((target(isa)))
+    #include <immintrin.h>
+#else
+    #define SIMD_X86 0
+    #define SIMD_TARGET(isa)
+#endif
+
+/**
+ * @namespace Simd
+ * @brief Runtime selection of vectorized kernels
+ */
+namespace Simd
+{
+    /**
+     * @enum Level
+     * @brief Instruction sets a kernel can be dispatched to, from the slowest.
+     */
+    enum class Level {
+        Scalar, ///> Portable C++ loop
+        Sse,    ///> 4 floats per instruction (SSE4.1)
+        Avx2    ///> 8 floats per instruction
+    };
+
+    /**
+     * @brief Gets the best level supported by the running CPU.
+     *
+     * The result is computed once and cached.
+     */
+    Level detect() noexcept;
+
+    /**
+     * @brief Lowers a requested level to what the running CPU supports.
+     * @param requested Preferred level
+     * @return requested, or the best supported level below it
+     */
+    Level clamp(Level requested) noexcept;
+} // namespace Simd
@@ -0,0 +1,171 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ThreadPool
+*/
+
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <exception>
+
+namespace Thread
+{
+    namespace
+    {
+        thread_local const ThreadPool *currentPool = nullptr; ///> Pool of the calling worker thread
+        thread_local size_t currentIndex = 0;                 ///> Queue index of the calling worker thread
+    } // namespace
+
+    ThreadPool::ThreadPool(size_t workers)
+    {
+        for (size_t i = 0; i < std::max<size_t>(workers, 1); ++i)
+            _queues.push_back(std::make_unique<WorkQueue>());
+        for (size_t i = 0; i < workers; ++i)
+            _workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard lock(_sleepMutex);
+            _stopping = true;
+        }
+        _wakeUp.notify_all();
+        for (auto &worker : _workers)
+            worker.join();
+    }
+
+    void ThreadPool::submit(Task task)
+    {
+        size_t index = currentPool == this ? currentIndex : _nextQueue.fetch_add(1) % _queues.size();
+
+        {
+            std::lock_guard lock(_sleepMutex);
+            _pending.fetch_add(1);
+        }
+        {
+            std::lock_guard lock(_queues[index]->mutex);
+            _queues[index]->tasks.push_back(std::move(task));
+        }
+        _wakeUp.notify_one();
+    }
+
+    void ThreadPool::parallelFor(size_t count, size_t grainSize, const std::function<void(size_t, size_t)> &fn)
+    {
+        if (count == 0)
+            return;
+        grainSize = std::max<size_t>(grainSize, 1);
+        if (count <= grainSize || _workers.empty()) {
+            for (size_t begin = 0; begin < count; begin += grainSize)
+                fn(begin, std::min(begin + grainSize, count));
+            return;
+        }
+        size_t chunks = (count + grainSize - 1) / grainSize;
+        std::atomic<size_t> remaining = chunks;
+        std::exception_ptr error = nullptr;
+        std::mutex errorMutex;
+
+        for (size_t chunk = 1; chunk < chunks; ++chunk) {
+            size_t begin = chunk * grainSize;
+            submit([&, begin]() {
+                try {
+                    fn(begin, std::min(begin + grainSize, count));
+                } catch (...) {
+                    std::lock_guard lock(errorMutex);
+                    if (!error)
+                        error = std::current_exception();
+                }
+                remaining.fetch_sub(1);
+            });
+        }
+        try {
+            fn(0, std::min(grainSize, count));
+        } catch (...) {
+            std::lock_guard lock(errorMutex);
+            if (!error)
+                error = std::current_exception();
+        }
+        remaining.fetch_sub(1);
+        helpWhile([&remaining]() {
+            return remaining.load() > 0;
+        });
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    void ThreadPool::helpWhile(const std::function<bool()> &condition)
+    {
+        Task task;
+        size_t home = currentPool == this ? currentIndex : 0;
+
+        while (condition()) {
+            if (tryTake(home, task))
+                task();
+            else
+                std::this_thread::yield();
+        }
+    }
+
+    size_t ThreadPool::workerCount() const noexcept
+    {
+        return _workers.size();
+    }
+
+    ThreadPool &ThreadPool::shared()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    size_t ThreadPool::defaultWorkerCount() noexcept
+    {
+        unsigned int hardware = std::thread::hardware_concurrency();
+        return hardware > 1 ? hardware - 1 : 0;
+    }
+
+    void ThreadPool::workerLoop(size_t index)
+    {
+        currentPool = this;
+        currentIndex = index;
+        Task task;
+
+        while (true) {
+            if (tryTake(index, task)) {
+                task();
+                continue;
+            }
+            std::unique_lock lock(_sleepMutex);
+            _wakeUp.wait(lock, [this]() {
+                return _stopping || _pending.load() > 0;
+            });
+            if (_stopping && _pending.load() == 0)
+                return;
+        }
+    }
+
+    bool ThreadPool::tryTake(size_t index, Task &task)
+    {
+        {
+            WorkQueue &own = *_queues[index];
+            std::lock_guard lock(own.mutex);
+            if (!own.tasks.empty()) {
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                _pending.fetch_sub(1);
+                return true;
+            }
+        }
+        for (size_t i = 1; i < _queues.size(); ++i) {
+            WorkQueue &victim = *_queues[(index + i) % _queues.size()];
+            std::lock_guard lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                _pending.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+} // namespace Thread
@@ -0,0 +1,130 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ThreadPool
+*/
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @namespace Thread
+ * @brief Multithreading utilities
+ */
+namespace Thread
+{
+    /**
+     * @class ThreadPool
+     * @brief Work-stealing pool of worker threads.
+     *
+     * Each worker owns a task deque: it pops its own tasks from the back and,
+     * when it runs out, steals from the front of the other workers' deques.
+     * Threads waiting on a parallelFor() help running tasks instead of sleeping,
+     * so a pool with zero workers still runs everything on the calling thread.
+     */
+    class ThreadPool {
+      public:
+        /** @brief Unit of work run by the pool */
+        using Task = std::function<void()>;
+
+        /**
+         * @brief Starts the worker threads.
+         * @param workers Number of background threads (the calling thread also takes part in parallelFor)
+         */
+        explicit ThreadPool(size_t workers = defaultWorkerCount());
+
+        /**
+         * @brief Stops and joins the worker threads, after running the queued tasks.
+         */
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        /**
+         * @brief Queues a task.
+         *
+         * Tasks submitted from a worker go to its own deque, others are spread round-robin.
+         *
+         * @param task Task to run
+         */
+        void submit(Task task);
+
+        /**
+         * @brief Runs a function over [0, count) split in chunks, and waits for completion.
+         *
+         * The first exception thrown by a chunk is rethrown once every chunk is done.
+         *
+         * @param count Number of items
+         * @param grainSize Maximum number of items per chunk (0 is treated as 1)
+         * @param fn Function called as `fn(begin, end)` for each chunk
+         */
+        void parallelFor(size_t count, size_t grainSize, const std::function<void(size_t, size_t)> &fn);
+
+        /**
+         * @brief Runs queued tasks on the calling thread while a condition holds.
+         *
+         * Used to wait for submitted work without leaving a core idle.
+         *
+         * @param condition Checked before each task, waiting stops once it returns false
+         */
+        void helpWhile(const std::function<bool()> &condition);
+
+        /**
+         * @brief Gets the number of background worker threads.
+         */
+        size_t workerCount() const noexcept;
+
+        /**
+         * @brief Gets the process-wide pool shared by the ECS.
+         * @return A pool sized from std::thread::hardware_concurrency()
+         */
+        static ThreadPool &shared();
+
+        /**
+         * @brief Number of workers used by default: one less than the hardware threads.
+         */
+        static size_t defaultWorkerCount() noexcept;
+
+      private:
+        /**
+         * @struct WorkQueue
+         * @brief Task deque of one worker.
+         */
+        struct WorkQueue {
+            std::mutex mutex;          ///> Protects tasks
+            std::deque<Task> tasks {}; ///> Queued tasks
+        };
+
+        /**
+         * @brief Main loop of a worker thread.
+         * @param index Index of the worker's queue
+         */
+        void workerLoop(size_t index);
+
+        /**
+         * @brief Takes a task, from the given queue first then from the others.
+         * @param index Preferred queue (popped from the back), others are stolen from the front
+         * @param task Receives the task
+         * @return true if a task was found
+         */
+        bool tryTake(size_t index, Task &task);
+
+        std::vector<std::unique_ptr<WorkQueue>> _queues = {}; ///> One deque per worker (at least one)
+        std::vector<std::thread> _workers = {};               ///> Worker threads
+        std::mutex _sleepMutex;                               ///> Guards sleeping workers
+        std::condition_variable _wakeUp;                      ///> Signals new tasks or shutdown
+        std::atomic<size_t> _pending = 0;                     ///> Number of queued tasks
+        std::atomic<size_t> _nextQueue = 0;                   ///> Round-robin cursor for external submits
+        bool _stopping = false;                               ///> Set when the pool shuts down
+    };
+} // namespace Thread
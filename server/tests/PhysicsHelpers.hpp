@@ -0,0 +1,58 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** PhysicsHelpers
+*/
+
+#pragma once
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstddef>
+#include <set>
+#include <utility>
+#include "ecs/components/Collision.hpp"
+#include "ecs/components/Position.hpp"
+#include "ecs/core/Registry.hpp"
+#include "physics/interfaces/IBroadPhase.hpp"
+
+/**
+ * @namespace PhysicsHelpers
+ * @brief Fixtures shared by the collision tests.
+ */
+namespace PhysicsHelpers
+{
+    /**
+     * @brief Creates an entity with a collision box.
+     * @return The new entity
+     */
+    inline Ecs::Entity spawn(Ecs::Registry &registry, float x, float y, float width, float height)
+    {
+        Ecs::Entity entity = registry.createEntity();
+
+        registry.emplaceComponent<Ecs::Position>(entity, x, y);
+        registry.emplaceComponent<Ecs::Collision>(entity, width, height);
+        return entity;
+    }
+
+    /**
+     * @brief Gets the pairs of a broad-phase whose boxes overlap, as ordered entity index pairs.
+     *
+     * Also checks that every pair is ordered (first < second).
+     */
+    inline std::set<std::pair<size_t, size_t>> overlappingPairs(const Physics::IBroadPhase &broadPhase)
+    {
+        std::set<std::pair<size_t, size_t>> pairs;
+
+        for (const auto &[first, second] : broadPhase.getPairs()) {
+            const auto &a = broadPhase.getProxies()[first];
+            const auto &b = broadPhase.getProxies()[second];
+
+            EXPECT_LT(first, second);
+            if (a.box.overlaps(b.box))
+                pairs.emplace(
+                    std::min(a.entity.index(), b.entity.index()), std::max(a.entity.index(), b.entity.index()));
+        }
+        return pairs;
+    }
+} // namespace PhysicsHelpers
@@ -0,0 +1,107 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** testArchetypeRegistry
+*/
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "ecs/archetype/ArchetypeRegistry.hpp"
+#include "ecs/components/Drawable.hpp"
+#include "ecs/components/Health.hpp"
+#include "ecs/components/Position.hpp"
+#include "ecs/components/Velocity.hpp"
+#include "ecs/core/Registry.hpp"
+
+namespace
+{
+    template <typename Backend>
+    double runWave(Backend &registry)
+    {
+        std::vector<Ecs::Entity> bullets;
+
+        for (int i = 0; i < 3000; ++i) {
+            auto e = registry.createEntity();
+            registry.template emplaceComponent<Ecs::Position>(e, static_cast<float>(i), 0.f);
+            if (i % 2 == 0)
+                registry.template emplaceComponent<Ecs::Velocity>(e, 1.f, 0.5f);
+            if (i % 3 == 0)
+                registry.template emplaceComponent<Ecs::Health>(e, i);
+            bullets.push_back(e);
+        }
+        for (size_t i = 0; i < bullets.size(); i += 4)
+            registry.destroyEntity(bullets[i]);
+        for (size_t i = 1; i < bullets.size(); i += 6)
+            registry.template removeComponent<Ecs::Velocity>(bullets[i]);
+        for (int tick = 0; tick < 10; ++tick)
+            registry.template view<Ecs::Position, Ecs::Velocity>(
+                [](Ecs::Entity, Ecs::Position &pos, Ecs::Velocity &vel) {
+                    pos.x += vel.vx;
+                    pos.y += vel.vy;
+                });
+        double checksum = 0.0;
+        registry.template view<Ecs::Position, Ecs::Health>([&](Ecs::Entity, Ecs::Position &pos, Ecs::Health &hp) {
+            checksum += static_cast<double>(pos.x + pos.y) + hp.hp;
+        });
+        return checksum;
+    }
+} // namespace
+
+TEST(ArchetypeRegistry, emplace_move_and_remove)
+{
+    Ecs::ArchetypeRegistry registry;
+    auto e = registry.createEntity();
+
+    registry.emplaceComponent<Ecs::Position>(e, 1.f, 2.f);
+    registry.emplaceComponent<Ecs::Drawable>(e, "player.png");
+    registry.emplaceComponent<Ecs::Velocity>(e, 3.f, 4.f);
+
+    ASSERT_TRUE(registry.hasComponent<Ecs::Velocity>(e));
+    ASSERT_EQ(registry.getComponent<Ecs::Position>(e)->y, 2.f);
+    ASSERT_EQ(registry.getComponent<Ecs::Drawable>(e)->sprite, "player.png");
+
+    registry.emplaceComponent<Ecs::Drawable>(e, "boss.png");
+    ASSERT_EQ(registry.getComponent<Ecs::Drawable>(e)->sprite, "boss.png");
+    ASSERT_EQ(registry.getSignature(e), (Ecs::signatureOf<Ecs::Position, Ecs::Drawable, Ecs::Velocity>()));
+    registry.emplaceComponent<Ecs::Drawable>(e, "player.png");
+
+    registry.removeComponent<Ecs::Position>(e);
+    ASSERT_FALSE(registry.hasComponent<Ecs::Position>(e));
+    ASSERT_EQ(registry.getComponent<Ecs::Drawable>(e)->sprite, "player.png");
+    ASSERT_EQ(registry.getComponent<Ecs::Velocity>(e)->vx, 3.f);
+    ASSERT_EQ(registry.getSignature(e), (Ecs::signatureOf<Ecs::Drawable, Ecs::Velocity>()));
+
+    registry.destroyEntity(e);
+    ASSERT_FALSE(registry.isAlive(e));
+    ASSERT_EQ(registry.getComponent<Ecs::Velocity>(e), nullptr);
+}
+
+TEST(ArchetypeRegistry, chunks_hold_many_entities)
+{
+    Ecs::ArchetypeRegistry registry;
+    std::vector<Ecs::Entity> entities;
+
+    for (int i = 0; i < 5000; ++i) {
+        auto e = registry.createEntity();
+        registry.emplaceComponent<Ecs::Position>(e, static_cast<float>(i), 0.f);
+        entities.push_back(e);
+    }
+    for (size_t i = 0; i < entities.size(); i += 2)
+        registry.destroyEntity(entities[i]);
+
+    size_t count = 0;
+    registry.view<Ecs::Position>([&](Ecs::Entity e, Ecs::Position &pos) {
+        ASSERT_EQ(pos.x, static_cast<float>(e.index()));
+        count++;
+    });
+    ASSERT_EQ(count, 2500);
+}
+
+TEST(ArchetypeRegistry, matches_sparse_set_backend)
+{
+    Ecs::Registry sparse;
+    Ecs::ArchetypeRegistry archetype;
+
+    ASSERT_EQ(runWave(sparse), runWave(archetype));
+}
@@ -0,0 +1,91 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** testCommandBuffer
+*/
+
+#include <gtest/gtest.h>
+#include "ecs/components/Health.hpp"
+#include "ecs/components/Position.hpp"
+#include "ecs/components/Velocity.hpp"
+#include "ecs/core/CommandBuffer.hpp"
+#include "ecs/core/Registry.hpp"
+
+TEST(CommandBuffer, changes_are_deferred_until_apply)
+{
+    Ecs::Registry registry;
+    Ecs::CommandBuffer commands;
+
+    for (int i = 0; i < 4; ++i) {
+        auto e = registry.createEntity();
+        registry.emplaceComponent<Ecs::Health>(e, i * 10);
+        registry.emplaceComponent<Ecs::Position>(e, 0.f, 0.f);
+    }
+
+    registry.view<Ecs::Health, Ecs::Position>([&](Ecs::Entity e, Ecs::Health &health, Ecs::Position &pos) {
+        if (health.hp == 0) {
+            commands.destroyEntity(e);
+            return;
+        }
+        auto bullet = commands.createEntity();
+        commands.emplaceComponent<Ecs::Position>(bullet, pos.x, pos.y);
+        commands.emplaceComponent<Ecs::Velocity>(bullet, 5.f, 0.f);
+    });
+
+    ASSERT_FALSE(commands.empty());
+    ASSERT_EQ(registry.getComponents<Ecs::Health>().size(), 4);
+
+    auto created = commands.apply(registry);
+
+    ASSERT_TRUE(commands.empty());
+    ASSERT_EQ(created.size(), 3);
+    ASSERT_EQ(registry.getComponents<Ecs::Health>().size(), 3);
+    ASSERT_EQ(registry.getComponents<Ecs::Velocity>().size(), 3);
+    for (auto bullet : created) {
+        ASSERT_TRUE(registry.hasComponent<Ecs::Position>(bullet));
+        ASSERT_TRUE(registry.hasComponent<Ecs::Velocity>(bullet));
+    }
+}
+
+TEST(CommandBuffer, remove_and_duplicate_destroy)
+{
+    Ecs::Registry registry;
+    Ecs::CommandBuffer commands;
+    auto e1 = registry.createEntity();
+    auto e2 = registry.createEntity();
+    registry.emplaceComponent<Ecs::Velocity>(e1, 1.f, 1.f);
+    registry.emplaceComponent<Ecs::Velocity>(e2, 1.f, 1.f);
+
+    commands.removeComponent<Ecs::Velocity>(e1);
+    commands.destroyEntity(e2);
+    commands.destroyEntity(e2);
+    commands.apply(registry);
+
+    ASSERT_TRUE(registry.isAlive(e1));
+    ASSERT_FALSE(registry.hasComponent<Ecs::Velocity>(e1));
+    ASSERT_FALSE(registry.isAlive(e2));
+
+    auto e3 = registry.createEntity();
+    auto e4 = registry.createEntity();
+    ASSERT_NE(e3.index(), e4.index());
+}
+
+TEST(CommandBuffer, operations_keep_recording_order)
+{
+    Ecs::Registry registry;
+    Ecs::CommandBuffer commands;
+    auto e1 = registry.createEntity();
+    auto e2 = registry.createEntity();
+    registry.emplaceComponent<Ecs::Health>(e1, 10);
+
+    commands.removeComponent<Ecs::Health>(e1);
+    commands.emplaceComponent<Ecs::Health>(e1, 20);
+    commands.emplaceComponent<Ecs::Health>(e2, 30);
+    commands.removeComponent<Ecs::Health>(e2);
+    commands.apply(registry);
+
+    ASSERT_TRUE(registry.hasComponent<Ecs::Health>(e1));
+    ASSERT_EQ(registry.getComponents<Ecs::Health>()[e1.index()]->hp, 20);
+    ASSERT_FALSE(registry.hasComponent<Ecs::Health>(e2));
+}
@@ -0,0 +1,60 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** testContinuousCollision
+*/
+
+#include <gtest/gtest.h>
+#include "PhysicsHelpers.hpp"
+#include "ecs/components/CollisionLayer.hpp"
+#include "ecs/components/FastMover.hpp"
+#include "ecs/components/Velocity.hpp"
+#include "physics/ContinuousCollision/ContinuousCollision.hpp"
+
+using PhysicsHelpers::spawn;
+
+TEST(ContinuousCollision, sweep_times)
+{
+    Physics::Aabb bullet = {0.f, 0.f, 2.f, 2.f};
+    float time = -1.f;
+
+    ASSERT_TRUE(Physics::ContinuousCollision::sweep(bullet, 100.f, 0.f, {50.f, -1.f, 52.f, 1.f}, time));
+    ASSERT_FLOAT_EQ(time, 0.48f);
+    ASSERT_TRUE(Physics::ContinuousCollision::sweep(bullet, 0.f, 0.f, {1.f, 1.f, 3.f, 3.f}, time));
+    ASSERT_FLOAT_EQ(time, 0.f);
+    ASSERT_FALSE(Physics::ContinuousCollision::sweep(bullet, 100.f, 0.f, {50.f, 5.f, 52.f, 7.f}, time));
+    ASSERT_FALSE(Physics::ContinuousCollision::sweep(bullet, 10.f, 0.f, {50.f, -1.f, 52.f, 1.f}, time));
+    ASSERT_FALSE(Physics::ContinuousCollision::sweep(bullet, -100.f, 0.f, {50.f, -1.f, 52.f, 1.f}, time));
+    ASSERT_TRUE(Physics::ContinuousCollision::sweep(bullet, 60.f, 60.f, {30.f, 30.f, 31.f, 31.f}, time));
+    ASSERT_FLOAT_EQ(time, 28.f / 60.f);
+}
+
+TEST(ContinuousCollision, laser_does_not_tunnel)
+{
+    Ecs::Registry registry;
+    Physics::UniformGrid grid({0.f, 0.f, 800.f, 600.f}, 32.f);
+    Physics::ContinuousCollision continuous;
+    Ecs::Entity laser = spawn(registry, 10.f, 100.f, 8.f, 2.f);
+    Ecs::Entity near = spawn(registry, 200.f, 95.f, 4.f, 20.f);
+    Ecs::Entity far = spawn(registry, 500.f, 90.f, 4.f, 20.f);
+    Ecs::Entity friendly = spawn(registry, 300.f, 90.f, 4.f, 20.f);
+
+    spawn(registry, 400.f, 300.f, 4.f, 20.f);
+    spawn(registry, 900.f, 100.f, 4.f, 20.f);
+    registry.emplaceComponent<Ecs::Velocity>(laser, 36000.f, 0.f);
+    registry.emplaceComponent<Ecs::FastMover>(laser);
+    registry.emplaceComponent<Ecs::CollisionLayer>(laser, 1u, 1u);
+    registry.emplaceComponent<Ecs::CollisionLayer>(friendly, 2u, UINT32_MAX);
+    grid.update(registry);
+
+    const auto &hits = continuous.update(registry, grid, 1.f / 60.f);
+
+    ASSERT_EQ(hits.size(), 2u);
+    ASSERT_EQ(hits[0].mover, laser);
+    ASSERT_EQ(hits[0].target, near);
+    ASSERT_EQ(hits[1].target, far);
+    ASSERT_LT(hits[0].time, hits[1].time);
+    ASSERT_GT(continuous.getVisitedCells(), 0u);
+    ASSERT_LT(continuous.getVisitedCells(), grid.getColumns() * grid.getRows());
+}
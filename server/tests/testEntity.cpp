@@ -18,4 +18,15 @@ TEST(Entity, custom_id)
 {
     Ecs::Entity e(42);
     ASSERT_EQ(static_cast<size_t>(e), 42);
-}
\ No newline at end of file
+}
+
+TEST(Entity, generation)
+{
+    Ecs::Entity a(3, 1);
+    Ecs::Entity b(3, 2);
+
+    ASSERT_EQ(a.index(), 3);
+    ASSERT_EQ(a.generation(), 1);
+    ASSERT_FALSE(a == b);
+    ASSERT_TRUE(a == Ecs::Entity(3, 1));
+}
@@ -0,0 +1,87 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** testMovementSystem
+*/
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "ecs/components/Drawable.hpp"
+#include "ecs/components/Position.hpp"
+#include "ecs/components/Velocity.hpp"
+#include "ecs/core/Registry.hpp"
+#include "ecs/systems/MovementSystem.hpp"
+
+namespace
+{
+    const Ecs::MovementSystem::Bounds PLAYFIELD = {0.f, 0.f, 800.f, 600.f};
+}
+
+TEST(MovementSystem, integrates_and_clamps)
+{
+    Ecs::Registry registry;
+    Ecs::MovementSystem movement(PLAYFIELD);
+    Ecs::Entity ship = registry.createEntity();
+    Ecs::Entity bullet = registry.createEntity();
+    Ecs::Entity idle = registry.createEntity();
+
+    registry.emplaceComponent<Ecs::Position>(ship, 100.f, 100.f);
+    registry.emplaceComponent<Ecs::Velocity>(ship, 10.f, -20.f);
+    registry.emplaceComponent<Ecs::Position>(bullet, 790.f, 5.f);
+    registry.emplaceComponent<Ecs::Velocity>(bullet, 600.f, -600.f);
+    registry.emplaceComponent<Ecs::Position>(idle, 1.f, 1.f);
+    registry.trackChanges<Ecs::Position>();
+
+    movement.update(registry, 0.5f);
+
+    auto &positions = registry.getComponents<Ecs::Position>();
+
+    ASSERT_TRUE(positions.isChanged(ship.index()));
+    ASSERT_FALSE(positions.isChanged(idle.index()));
+    ASSERT_FLOAT_EQ(positions[ship.index()]->x, 105.f);
+    ASSERT_FLOAT_EQ(positions[ship.index()]->y, 90.f);
+    ASSERT_FLOAT_EQ(positions[bullet.index()]->x, 800.f);
+    ASSERT_FLOAT_EQ(positions[bullet.index()]->y, 0.f);
+    ASSERT_FLOAT_EQ(positions[idle.index()]->x, 1.f);
+}
+
+TEST(MovementSystem, leaves_the_pools_free_for_groups)
+{
+    Ecs::Registry registry;
+    Ecs::MovementSystem movement(PLAYFIELD);
+    Ecs::Entity ship = registry.createEntity();
+
+    registry.emplaceComponent<Ecs::Position>(ship, 10.f, 10.f);
+    registry.emplaceComponent<Ecs::Velocity>(ship, 4.f, 2.f);
+    registry.group<Ecs::Position, Ecs::Drawable>();
+
+    movement.update(registry, 1.f);
+
+    ASSERT_FLOAT_EQ(registry.getComponents<Ecs::Position>()[ship.index()]->x, 14.f);
+    ASSERT_FLOAT_EQ(registry.getComponents<Ecs::Position>()[ship.index()]->y, 12.f);
+}
+
+TEST(MovementSystem, kernels_match_scalar)
+{
+    const size_t count = 37;
+    std::vector<float> velocities(count);
+    std::vector<float> expected(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        expected[i] = static_cast<float>(i * 13 % 700);
+        velocities[i] = static_cast<float>(i % 7) * 40.f - 120.f;
+    }
+    std::vector<float> initial = expected;
+
+    Ecs::MovementSystem::integrate(
+        Simd::Level::Scalar, expected.data(), velocities.data(), count, 0.25f, PLAYFIELD.minX, PLAYFIELD.maxX);
+    for (Simd::Level level : {Simd::Level::Sse, Simd::Level::Avx2}) {
+        std::vector<float> positions = initial;
+
+        Ecs::MovementSystem::integrate(
+            level, positions.data(), velocities.data(), count, 0.25f, PLAYFIELD.minX, PLAYFIELD.maxX);
+        for (size_t i = 0; i < count; ++i)
+            ASSERT_FLOAT_EQ(positions[i], expected[i]) << "entity " << i;
+    }
+}
@@ -0,0 +1,82 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** testNarrowPhase
+*/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include "PhysicsHelpers.hpp"
+#include "ecs/components/CollisionLayer.hpp"
+#include "physics/NarrowPhase/NarrowPhase.hpp"
+#include "physics/UniformGrid/UniformGrid.hpp"
+
+namespace
+{
+    enum Layer : uint32_t {
+        PLAYER = 1 << 0,
+        ENEMY = 1 << 1,
+        PLAYER_BULLET = 1 << 2,
+        ENEMY_BULLET = 1 << 3
+    };
+
+    Ecs::Entity spawn(Ecs::Registry &registry, float x, float y, uint32_t layer, uint32_t mask)
+    {
+        Ecs::Entity entity = PhysicsHelpers::spawn(registry, x, y, 10.f, 10.f);
+
+        registry.emplaceComponent<Ecs::CollisionLayer>(entity, layer, mask);
+        return entity;
+    }
+}
+
+TEST(NarrowPhase, layers_filter_contacts)
+{
+    Ecs::Registry registry;
+    Physics::UniformGrid grid({0.f, 0.f, 800.f, 600.f}, 32.f);
+    Physics::NarrowPhase narrow;
+    Ecs::Entity player = spawn(registry, 100.f, 100.f, PLAYER, ENEMY | ENEMY_BULLET);
+    Ecs::Entity enemy = spawn(registry, 105.f, 105.f, ENEMY, PLAYER | PLAYER_BULLET);
+    Ecs::Entity shot = spawn(registry, 102.f, 102.f, PLAYER_BULLET, ENEMY);
+
+    PhysicsHelpers::spawn(registry, 111.f, 90.f, 5.f, 5.f);
+    grid.update(registry);
+    narrow.update(grid);
+
+    std::vector<std::pair<Ecs::Entity, Ecs::Entity>> expected = {{player, enemy}, {enemy, shot}};
+
+    ASSERT_EQ(narrow.getContacts().size(), expected.size());
+    for (const auto &contact : narrow.getContacts())
+        ASSERT_TRUE(std::find_if(expected.begin(), expected.end(), [&contact](const auto &pair) {
+            return (pair.first == contact.first && pair.second == contact.second)
+                || (pair.first == contact.second && pair.second == contact.first);
+        }) != expected.end());
+    ASSERT_EQ(narrow.getFiltered(), 1u);
+}
+
+TEST(NarrowPhase, kernels_match_scalar)
+{
+    Physics::NarrowPhase::Boxes first;
+    Physics::NarrowPhase::Boxes second;
+    std::vector<uint32_t> expected;
+
+    for (size_t i = 0; i < 45; ++i) {
+        float x = static_cast<float>(i * 7 % 30);
+        float y = static_cast<float>(i * 11 % 30);
+
+        first.push({x, y, x + 10.f, y + 10.f});
+        second.push({static_cast<float>(i % 25), static_cast<float>(i * 3 % 25), static_cast<float>(i % 25) + 5.f,
+            static_cast<float>(i * 3 % 25) + 5.f});
+    }
+    Physics::NarrowPhase::overlap(Simd::Level::Scalar, first, second, expected);
+    ASSERT_FALSE(expected.empty());
+    ASSERT_LT(expected.size(), 45u);
+    for (Simd::Level level : {Simd::Level::Sse, Simd::Level::Avx2}) {
+        std::vector<uint32_t> hits;
+
+        Physics::NarrowPhase::overlap(level, first, second, hits);
+        ASSERT_EQ(hits, expected);
+    }
+}
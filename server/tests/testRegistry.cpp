@@ -6,6 +6,12 @@
 */
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+#include "ecs/components/Drawable.hpp"
 #include "ecs/components/Health.hpp"
 #include "ecs/components/Position.hpp"
 #include "ecs/components/Velocity.hpp"
@@ -78,3 +84,630 @@ TEST(Registry, view_position_velocity)
     ASSERT_EQ(pos[static_cast<size_t>(e1)]->x, 2.f);
     ASSERT_EQ(pos[static_cast<size_t>(e3)]->y, 4.f);
 }
+
+TEST(Registry, recycle_destroyed_index)
+{
+    Ecs::Registry registry;
+
+    auto e1 = registry.createEntity();
+    registry.createEntity();
+    registry.destroyEntity(e1);
+    auto e3 = registry.createEntity();
+
+    ASSERT_EQ(e3.index(), e1.index());
+    ASSERT_EQ(e3.generation(), e1.generation() + 1);
+    ASSERT_FALSE(registry.isAlive(e1));
+    ASSERT_TRUE(registry.isAlive(e3));
+}
+
+TEST(Registry, stale_handle_is_rejected)
+{
+    Ecs::Registry registry;
+
+    auto stale = registry.createEntity();
+    registry.destroyEntity(stale);
+    auto fresh = registry.createEntity();
+    registry.emplaceComponent<Ecs::Health>(fresh, 50);
+
+    registry.emplaceComponent<Ecs::Position>(stale, 1.f, 1.f);
+    registry.destroyEntity(stale);
+
+    ASSERT_FALSE(registry.hasComponent<Ecs::Position>(fresh));
+    ASSERT_FALSE(registry.hasComponent<Ecs::Health>(stale));
+    ASSERT_TRUE(registry.hasComponent<Ecs::Health>(fresh));
+    ASSERT_TRUE(registry.isAlive(fresh));
+}
+
+TEST(Registry, component_ids_are_dense_and_stable)
+{
+    auto position = Ecs::ComponentFamily::id<Ecs::Position>();
+    auto velocity = Ecs::ComponentFamily::id<Ecs::Velocity>();
+
+    ASSERT_NE(position, velocity);
+    ASSERT_EQ(position, Ecs::ComponentFamily::id<Ecs::Position>());
+    ASSERT_EQ(position, Ecs::ComponentFamily::id<const Ecs::Position>());
+    ASSERT_LT(position, Ecs::ComponentFamily::count());
+    ASSERT_LT(velocity, Ecs::ComponentFamily::count());
+}
+
+TEST(Registry, get_unregistered_component_throws)
+{
+    Ecs::Registry registry;
+
+    ASSERT_THROW(registry.getComponents<Ecs::Velocity>(), std::out_of_range);
+}
+
+TEST(Registry, view_range_for)
+{
+    Ecs::Registry registry;
+
+    for (int i = 0; i < 10; ++i) {
+        auto e = registry.createEntity();
+        registry.emplaceComponent<Ecs::Position>(e, static_cast<float>(i), 0.f);
+        if (i % 5 == 0)
+            registry.emplaceComponent<Ecs::Velocity>(e, 1.f, 0.f);
+    }
+
+    float sum = 0.f;
+    for (auto [entity, pos, vel] : registry.view<Ecs::Position, Ecs::Velocity>()) {
+        pos.x += vel.vx;
+        sum += pos.x;
+    }
+    ASSERT_EQ(sum, 7.f);
+
+    auto view = registry.view<Ecs::Velocity, Ecs::Position>();
+    ASSERT_EQ(view.sizeHint(), 2);
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 2);
+    ASSERT_EQ(std::ranges::count_if(view, [](auto tuple) {
+        return std::get<2>(tuple).x > 2.f;
+    }), 1);
+}
+
+TEST(Registry, view_unregistered_is_empty)
+{
+    Ecs::Registry registry;
+    auto e = registry.createEntity();
+    registry.emplaceComponent<Ecs::Position>(e, 1.f, 1.f);
+
+    auto view = registry.view<Ecs::Position, Ecs::Health>();
+
+    ASSERT_TRUE(view.begin() == view.end());
+}
+
+TEST(Registry, view_callback_destroys_entities)
+{
+    Ecs::Registry registry;
+
+    for (int i = 0; i < 8; ++i)
+        registry.emplaceComponent<Ecs::Health>(registry.createEntity(), i);
+
+    size_t visited = 0;
+    registry.view<Ecs::Health>([&](Ecs::Entity entity, Ecs::Health &health) {
+        ++visited;
+        if (health.hp % 2 == 0)
+            registry.destroyEntity(entity);
+    });
+    ASSERT_EQ(visited, 8);
+
+    std::vector<int> survivors;
+    registry.view<Ecs::Health>([&](Ecs::Entity entity, Ecs::Health &health) {
+        survivors.push_back(health.hp);
+        registry.destroyEntity(entity);
+    });
+    std::ranges::sort(survivors);
+    ASSERT_EQ(survivors, (std::vector<int>{1, 3, 5, 7}));
+    ASSERT_TRUE(registry.view<Ecs::Health>().begin() == registry.view<Ecs::Health>().end());
+}
+
+TEST(Registry, signature_tracks_components)
+{
+    Ecs::Registry registry;
+    auto entity = registry.createEntity();
+
+    registry.emplaceComponent<Ecs::Position>(entity, 1.f, 1.f);
+    registry.emplaceComponent<Ecs::Velocity>(entity, 1.f, 1.f);
+    ASSERT_EQ(registry.getSignature(entity), (Ecs::signatureOf<Ecs::Position, Ecs::Velocity>()));
+
+    registry.removeComponent<Ecs::Velocity>(entity);
+    ASSERT_FALSE(registry.hasComponent<Ecs::Velocity>(entity));
+    ASSERT_EQ(registry.getComponents<Ecs::Velocity>().size(), 0);
+    ASSERT_EQ(registry.getSignature(entity), Ecs::signatureOf<Ecs::Position>());
+
+    registry.destroyEntity(entity);
+    ASSERT_TRUE(registry.getSignature(entity).none());
+    ASSERT_EQ(registry.getComponents<Ecs::Position>().size(), 0);
+}
+
+TEST(Registry, group_packs_matching_entities)
+{
+    Ecs::Registry registry;
+    std::vector<Ecs::Entity> entities;
+
+    for (int i = 0; i < 6; ++i) {
+        auto e = registry.createEntity();
+        registry.emplaceComponent<Ecs::Position>(e, static_cast<float>(i), 0.f);
+        if (i % 2 == 0)
+            registry.emplaceComponent<Ecs::Velocity>(e, 1.f, 0.f);
+        entities.push_back(e);
+    }
+
+    auto &group = registry.group<Ecs::Position, Ecs::Velocity>();
+    ASSERT_EQ(group.size(), 3);
+    ASSERT_EQ(&group, (&registry.group<Ecs::Position, Ecs::Velocity>()));
+
+    registry.emplaceComponent<Ecs::Velocity>(entities[1], 2.f, 0.f);
+    ASSERT_EQ(group.size(), 4);
+    registry.removeComponent<Ecs::Velocity>(entities[0]);
+    registry.destroyEntity(entities[2]);
+    ASSERT_EQ(group.size(), 2);
+
+    int processed = 0;
+    group.each([&](Ecs::Entity e, Ecs::Position &pos, Ecs::Velocity &vel) {
+        ASSERT_TRUE(registry.hasComponent<Ecs::Velocity>(e));
+        pos.x += vel.vx;
+        processed++;
+    });
+    ASSERT_EQ(processed, 2);
+    ASSERT_EQ(registry.getComponents<Ecs::Position>()[entities[1].index()]->x, 3.f);
+    ASSERT_EQ(registry.getComponents<Ecs::Position>()[entities[4].index()]->x, 5.f);
+
+    auto &velocities = registry.getComponents<Ecs::Velocity>();
+    for (size_t i = 0; i < group.size(); ++i)
+        ASSERT_EQ(&group.data<Ecs::Velocity>()[i], velocities[group.entities()[i]]);
+}
+
+TEST(Registry, group_ownership_is_exclusive)
+{
+    Ecs::Registry registry;
+
+    registry.group<Ecs::Position, Ecs::Velocity>();
+
+    ASSERT_THROW((registry.group<Ecs::Position, Ecs::Health>()), std::logic_error);
+}
+
+TEST(Registry, groups_survive_registry_moves)
+{
+    Ecs::Registry live;
+    Ecs::Entity e = live.createEntity();
+
+    live.emplaceComponent<Ecs::Position>(e, 1.f, 2.f);
+    live.emplaceComponent<Ecs::Velocity>(e, 3.f, 4.f);
+    auto &group = live.group<Ecs::Position, Ecs::Velocity>();
+    Ecs::Registry moved(std::move(live));
+    Ecs::Registry sim;
+
+    sim = moved.fork();
+    sim.destroyEntity(e);
+    Ecs::Entity recycled = sim.createEntity();
+
+    sim.emplaceComponent<Ecs::Position>(recycled, 5.f, 6.f);
+    sim.emplaceComponent<Ecs::Velocity>(recycled, 7.f, 8.f);
+    ASSERT_EQ(&group, (&moved.group<Ecs::Position, Ecs::Velocity>()));
+
+    int visited = 0;
+
+    group.each([&](Ecs::Entity entity, Ecs::Position &, Ecs::Velocity &) {
+        ASSERT_EQ(entity, e);
+        visited++;
+    });
+    sim.group<Ecs::Position, Ecs::Velocity>().each([&](Ecs::Entity entity, Ecs::Position &pos, Ecs::Velocity &) {
+        ASSERT_EQ(entity, recycled);
+        ASSERT_EQ(pos.x, 5.f);
+        visited++;
+    });
+    ASSERT_EQ(visited, 2);
+}
+
+TEST(Registry, parallel_view_updates_every_entity)
+{
+    Ecs::Registry registry;
+    Thread::ThreadPool pool(3);
+
+    for (int i = 0; i < 5000; ++i) {
+        auto e = registry.createEntity();
+        registry.emplaceComponent<Ecs::Position>(e, 0.f, 0.f);
+        if (i % 3 != 0)
+            registry.emplaceComponent<Ecs::Velocity>(e, 1.f, 2.f);
+    }
+
+    registry.parallelView<Ecs::Position, Ecs::Velocity>(
+        [](Ecs::Entity, Ecs::Position &pos, Ecs::Velocity &vel) {
+            pos.x += vel.vx;
+            pos.y += vel.vy;
+        },
+        100, pool);
+
+    int moved = 0;
+    registry.view<Ecs::Position>([&](Ecs::Entity e, Ecs::Position &pos) {
+        bool hasVelocity = registry.hasComponent<Ecs::Velocity>(e);
+        ASSERT_EQ(pos.x, hasVelocity ? 1.f : 0.f);
+        moved += hasVelocity ? 1 : 0;
+    });
+    ASSERT_EQ(moved, 3333);
+}
+
+TEST(Registry, parallel_view_tracks_changes)
+{
+    Ecs::Registry registry;
+    Thread::ThreadPool pool(4);
+    std::vector<Ecs::Entity> entities = registry.createEntities(4000);
+
+    for (size_t i = 0; i < entities.size(); ++i) {
+        registry.emplaceComponent<Ecs::Position>(entities[i], 0.f, 0.f);
+        if (i % 4 != 0)
+            registry.emplaceComponent<Ecs::Velocity>(entities[i], 1.f, 0.f);
+    }
+    registry.trackChanges<Ecs::Position>();
+    registry.trackChanges<Ecs::Velocity>();
+    registry.getComponents<Ecs::Position>().markChanged(entities[0].index());
+
+    registry.parallelView<Ecs::Position, const Ecs::Velocity>(
+        [](Ecs::Entity, Ecs::Position &pos, const Ecs::Velocity &vel) {
+            pos.x += vel.vx;
+        },
+        64, pool);
+
+    auto &positions = registry.getComponents<Ecs::Position>();
+    std::vector<size_t> changed = positions.changed();
+
+    std::sort(changed.begin(), changed.end());
+    ASSERT_EQ(std::adjacent_find(changed.begin(), changed.end()), changed.end());
+    ASSERT_EQ(changed.size(), 3001u);
+    for (size_t i = 0; i < entities.size(); ++i)
+        ASSERT_EQ(positions.isChanged(entities[i].index()), i % 4 != 0 || i == 0);
+    ASSERT_TRUE(registry.getComponents<Ecs::Velocity>().changed().empty());
+
+    positions.markChanged(entities[4].index());
+    ASSERT_EQ(positions.changed().size(), 3002u);
+}
+
+TEST(Registry, track_changes_through_views)
+{
+    Ecs::Registry registry;
+    std::vector<Ecs::Entity> entities;
+
+    registry.trackChanges<Ecs::Position>();
+    for (int i = 0; i < 4; ++i) {
+        auto e = registry.createEntity();
+        registry.emplaceComponent<Ecs::Position>(e, 0.f, 0.f);
+        entities.push_back(e);
+    }
+    registry.emplaceComponent<Ecs::Velocity>(entities[2], 1.f, 0.f);
+    ASSERT_EQ(registry.getComponents<Ecs::Position>().added().size(), 4);
+    registry.clearChanges();
+
+    registry.view<Ecs::Position, Ecs::Velocity>([](Ecs::Entity, Ecs::Position &pos, Ecs::Velocity &vel) {
+        pos.x += vel.vx;
+    });
+    for (auto [e, pos] : registry.view<const Ecs::Position>())
+        ASSERT_GE(pos.x, 0.f);
+
+    auto &positions = registry.getComponents<Ecs::Position>();
+    ASSERT_EQ(positions.changed(), (std::vector<size_t>{entities[2].index()}));
+
+    registry.destroyEntity(entities[0]);
+    ASSERT_EQ(positions.removed(), (std::vector<size_t>{entities[0].index()}));
+}
+
+TEST(Registry, bulk_create_and_emplace)
+{
+    Ecs::Registry registry;
+    auto first = registry.createEntities(3);
+    registry.destroyEntity(first[1]);
+
+    auto bullets = registry.createEntities(500);
+    ASSERT_EQ(bullets.size(), 500);
+    ASSERT_EQ(bullets[0].index(), first[1].index());
+    ASSERT_EQ(bullets[1].index(), 3);
+
+    registry.emplaceComponents(bullets, Ecs::Position {10.f, 20.f}, Ecs::Velocity {8.f, 0.f});
+    registry.emplaceComponents(std::span(first), Ecs::Health {5, 5});
+
+    ASSERT_EQ(registry.getComponents<Ecs::Position>().size(), 500);
+    ASSERT_EQ(registry.getComponents<Ecs::Health>().size(), 2);
+    ASSERT_FALSE(registry.hasComponent<Ecs::Health>(first[1]));
+    ASSERT_EQ(registry.getComponents<Ecs::Velocity>()[bullets[499].index()]->vx, 8.f);
+    auto moving = registry.view<Ecs::Position, Ecs::Velocity>();
+    ASSERT_EQ(std::distance(moving.begin(), moving.end()), 500);
+}
+
+TEST(Registry, emplace_constructs_in_place)
+{
+    Ecs::Registry registry;
+    auto e = registry.createEntity();
+
+    registry.emplaceComponent<Ecs::Drawable>(e, "enemy.png", false);
+
+    auto *drawable = registry.getComponents<Ecs::Drawable>()[e.index()];
+    ASSERT_EQ(drawable->sprite, "enemy.png");
+    ASSERT_FALSE(drawable->drawable);
+}
+
+namespace
+{
+    struct Player {};
+    struct Boss {};
+}
+
+TEST(Registry, tags_are_stored_as_bits)
+{
+    Ecs::Registry registry;
+    Ecs::Entity e = registry.createEntity();
+
+    registry.emplaceComponent<Player>(e);
+
+    ASSERT_TRUE(registry.hasComponent<Player>(e));
+    ASSERT_TRUE(registry.getComponents<Player>().contains(e.index()));
+    ASSERT_EQ(registry.getComponents<Player>().size(), 1);
+
+    registry.destroyEntity(e);
+
+    ASSERT_EQ(registry.getComponents<Player>().size(), 0);
+}
+
+TEST(Registry, view_mixes_tags_and_data)
+{
+    Ecs::Registry registry;
+    std::vector<Ecs::Entity> entities = registry.createEntities(300);
+
+    for (Ecs::Entity e : entities)
+        registry.emplaceComponent<Ecs::Position>(e, static_cast<float>(e.index()), 0.f);
+    registry.emplaceComponent<Boss>(entities[5]);
+    registry.emplaceComponent<Boss>(entities[130]);
+    registry.emplaceComponent<Boss>(entities[299]);
+    registry.emplaceComponent<Player>(entities[130]);
+    registry.emplaceComponent<Player>(entities[299]);
+    registry.removeComponent<Ecs::Position>(entities[299]);
+
+    auto bosses = registry.view<Ecs::Position, const Boss>();
+    std::vector<size_t> seen;
+
+    ASSERT_TRUE(bosses.scansTags());
+    for (auto [entity, pos, boss] : bosses)
+        seen.push_back(entity.index());
+    ASSERT_EQ(seen, (std::vector<size_t>{5, 130}));
+
+    seen.clear();
+    registry.view<Boss, Player>([&seen](Ecs::Entity entity, Boss &, Player &) {
+        seen.push_back(entity.index());
+    });
+    ASSERT_EQ(seen, (std::vector<size_t>{130, 299}));
+
+    auto players = registry.view<Player, Ecs::Position>();
+    size_t count = 0;
+    auto counter = [&count](Ecs::Entity, Player &, Ecs::Position &) { count++; };
+
+    players.each(0, 128, counter);
+    ASSERT_EQ(count, 0);
+    players.each(128, players.sizeHint(), counter);
+    ASSERT_EQ(count, 1);
+}
+
+TEST(Registry, view_driven_by_data_filters_tags)
+{
+    Ecs::Registry registry;
+    std::vector<Ecs::Entity> entities = registry.createEntities(10);
+
+    for (Ecs::Entity e : entities)
+        registry.emplaceComponent<Player>(e);
+    registry.emplaceComponent<Ecs::Position>(entities[2]);
+    registry.emplaceComponent<Ecs::Position>(entities[7]);
+    registry.removeComponent<Player>(entities[7]);
+
+    auto players = registry.view<Ecs::Position, Player>();
+
+    ASSERT_FALSE(players.scansTags());
+    ASSERT_EQ(std::distance(players.begin(), players.end()), 1);
+}
+
+namespace
+{
+    struct Dead {};
+}
+
+TEST(Registry, view_excludes_components)
+{
+    Ecs::Registry registry;
+    std::vector<Ecs::Entity> entities = registry.createEntities(4);
+
+    for (Ecs::Entity e : entities) {
+        registry.emplaceComponent<Ecs::Position>(e);
+        registry.emplaceComponent<Ecs::Velocity>(e, 1.f, 0.f);
+    }
+    registry.emplaceComponent<Dead>(entities[1]);
+    registry.emplaceComponent<Ecs::Health>(entities[2]);
+
+    std::vector<size_t> seen;
+
+    for (auto [entity, pos, vel] : registry.view<Ecs::Position, Ecs::Velocity>(Ecs::exclude<Dead>))
+        seen.push_back(entity.index());
+    std::ranges::sort(seen);
+    ASSERT_EQ(seen, (std::vector<size_t>{0, 2, 3}));
+
+    size_t moved = 0;
+
+    registry.view<Ecs::Position, const Ecs::Velocity>(Ecs::exclude<Dead, Ecs::Health>,
+        [&moved](Ecs::Entity, Ecs::Position &pos, const Ecs::Velocity &vel) {
+            pos.x += vel.vx;
+            moved++;
+        });
+    ASSERT_EQ(moved, 2);
+    ASSERT_EQ(registry.getComponents<Ecs::Position>()[entities[1].index()]->x, 0.f);
+    ASSERT_EQ(registry.getComponents<Ecs::Position>()[entities[3].index()]->x, 1.f);
+}
+
+TEST(Registry, view_yields_optional_components)
+{
+    Ecs::Registry registry;
+    Ecs::Entity hurt = registry.createEntity();
+    Ecs::Entity fresh = registry.createEntity();
+
+    registry.emplaceComponent<Ecs::Position>(hurt);
+    registry.emplaceComponent<Ecs::Position>(fresh);
+    registry.emplaceComponent<Ecs::Health>(hurt, 40, 100);
+
+    size_t withHealth = 0;
+    size_t total = 0;
+
+    for (auto [entity, pos, health] : registry.view<Ecs::Position, Ecs::Optional<const Ecs::Health>>()) {
+        total++;
+        if (health) {
+            withHealth++;
+            ASSERT_EQ(entity, hurt);
+            ASSERT_EQ(health->hp, 40);
+        }
+    }
+    ASSERT_EQ(total, 2);
+    ASSERT_EQ(withHealth, 1);
+
+    total = 0;
+    registry.view<Ecs::Position, Ecs::Optional<Ecs::Velocity>>(
+        [&total](Ecs::Entity, Ecs::Position &, Ecs::Velocity *vel) {
+            ASSERT_EQ(vel, nullptr);
+            total++;
+        });
+    ASSERT_EQ(total, 2);
+}
+
+TEST(Registry, fork_is_isolated_from_parent)
+{
+    Ecs::Registry parent;
+    std::vector<Ecs::Entity> entities = parent.createEntities(3);
+
+    for (Ecs::Entity e : entities) {
+        parent.emplaceComponent<Ecs::Position>(e, 1.f, 1.f);
+        parent.emplaceComponent<Ecs::Velocity>(e, 2.f, 0.f);
+    }
+    parent.emplaceComponent<Dead>(entities[0]);
+
+    Ecs::Registry fork = parent.fork();
+    float sum = 0.f;
+
+    fork.view<const Ecs::Position>([&sum](Ecs::Entity, const Ecs::Position &pos) { sum += pos.x; });
+    ASSERT_EQ(sum, 3.f);
+
+    fork.view<Ecs::Position, const Ecs::Velocity>(Ecs::exclude<Dead>,
+        [](Ecs::Entity, Ecs::Position &pos, const Ecs::Velocity &vel) { pos.x += vel.vx; });
+    fork.destroyEntity(entities[1]);
+    fork.emplaceComponent<Dead>(entities[2]);
+
+    ASSERT_EQ(parent.getComponents<Ecs::Position>()[entities[2].index()]->x, 1.f);
+    ASSERT_TRUE(parent.isAlive(entities[1]));
+    ASSERT_FALSE(parent.hasComponent<Dead>(entities[2]));
+    ASSERT_EQ(fork.getComponents<Ecs::Position>()[entities[2].index()]->x, 3.f);
+    ASSERT_FALSE(fork.isAlive(entities[1]));
+
+    parent.removeComponent<Ecs::Velocity>(entities[0]);
+    ASSERT_TRUE(fork.hasComponent<Ecs::Velocity>(entities[0]));
+    ASSERT_EQ(fork.getComponents<Ecs::Velocity>().size(), 2);
+}
+
+TEST(Registry, fork_copies_groups)
+{
+    Ecs::Registry parent;
+    std::vector<Ecs::Entity> entities = parent.createEntities(4);
+
+    for (Ecs::Entity e : entities)
+        parent.emplaceComponent<Ecs::Position>(e);
+    parent.emplaceComponent<Ecs::Health>(entities[1]);
+    parent.emplaceComponent<Ecs::Health>(entities[3]);
+    auto &parentGroup = parent.group<Ecs::Position, Ecs::Health>();
+
+    Ecs::Registry fork = parent.fork();
+    auto &forkGroup = fork.group<Ecs::Position, Ecs::Health>();
+
+    ASSERT_NE(&forkGroup, &parentGroup);
+    ASSERT_EQ(forkGroup.size(), 2);
+
+    fork.emplaceComponent<Ecs::Health>(entities[0]);
+    ASSERT_EQ(forkGroup.size(), 3);
+    ASSERT_EQ(parentGroup.size(), 2);
+}
+
+namespace
+{
+    struct SpawnLog {
+        std::vector<std::string> events;
+
+        void created(Ecs::Registry &registry, Ecs::Entity entity)
+        {
+            events.push_back("create " + std::to_string(registry.getComponents<Ecs::Health>()[entity.index()]->hp));
+        }
+
+        void destroyed(Ecs::Registry &registry, Ecs::Entity entity)
+        {
+            events.push_back("destroy " + std::to_string(registry.getComponents<Ecs::Health>()[entity.index()]->hp));
+        }
+
+        void updated(Ecs::Registry &registry, Ecs::Entity entity)
+        {
+            events.push_back("update " + std::to_string(registry.getComponents<Ecs::Health>()[entity.index()]->hp));
+        }
+    };
+}
+
+TEST(Registry, component_signals)
+{
+    Ecs::Registry registry;
+    SpawnLog log;
+
+    registry.onConstruct<Ecs::Health>().connect<&SpawnLog::created>(log);
+    registry.onDestroy<Ecs::Health>().connect<&SpawnLog::destroyed>(log);
+    registry.onUpdate<Ecs::Health>().connect<&SpawnLog::updated>(log);
+
+    Ecs::Entity first = registry.createEntity();
+    Ecs::Entity second = registry.createEntity();
+
+    registry.emplaceComponent<Ecs::Health>(first, 10, 10);
+    registry.emplaceComponent<Ecs::Health>(first, 20, 20);
+    registry.replaceComponent<Ecs::Health>(first, 15, 20);
+    registry.replaceComponent<Ecs::Health>(second, 99, 99);
+    registry.emplaceComponent<Ecs::Position>(first);
+    registry.removeComponent<Ecs::Health>(first);
+    registry.emplaceComponent<Ecs::Health>(second, 5, 5);
+    registry.destroyEntity(second);
+
+    Ecs::Registry fork = registry.fork();
+
+    fork.emplaceComponent<Ecs::Health>(fork.createEntity(), 1, 1);
+
+    ASSERT_EQ(log.events, (std::vector<std::string>{
+        "create 10", "update 20", "update 15", "destroy 15", "create 5", "destroy 5"}));
+    ASSERT_FALSE(registry.hasComponent<Ecs::Health>(second));
+}
+
+TEST(Registry, memory_stats_and_compact)
+{
+    Ecs::Registry registry;
+    std::vector<Ecs::Entity> entities = registry.createEntities(100);
+
+    for (Ecs::Entity e : entities)
+        registry.emplaceComponent<Ecs::Position>(e);
+    for (size_t i = 0; i < 50; ++i)
+        registry.emplaceComponent<Ecs::Health>(entities[i]);
+    registry.emplaceComponent<Dead>(entities[99]);
+    auto &group = registry.group<Ecs::Position, Ecs::Health>();
+
+    for (size_t i = 0; i < 90; i += 2)
+        registry.destroyEntity(entities[i]);
+
+    std::vector<Ecs::PoolStats> before = registry.getMemoryStats();
+
+    ASSERT_EQ(before.size(), 3);
+    ASSERT_EQ(before[0].live, 55);
+    ASSERT_GE(before[0].bytesReserved, before[0].bytesUsed);
+
+    registry.compact();
+
+    std::vector<Ecs::PoolStats> after = registry.getMemoryStats();
+
+    ASSERT_LE(after[0].bytesReserved, before[0].bytesReserved);
+    ASSERT_LT(after[0].fragmentation(), before[0].fragmentation());
+    ASSERT_EQ(after[2].live, 1);
+    ASSERT_EQ(group.size(), 25);
+    for (size_t i = 0; i < group.size(); ++i) {
+        ASSERT_EQ(group.entities()[i], 2 * i + 1);
+        ASSERT_EQ(registry.getComponents<Ecs::Health>().entities()[i], 2 * i + 1);
+    }
+    ASSERT_EQ(registry.createEntity().index(), 0);
+}
@@ -0,0 +1,70 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** testScheduler
+*/
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "ecs/components/AIBrain.hpp"
+#include "ecs/components/Attack.hpp"
+#include "ecs/components/Health.hpp"
+#include "ecs/components/Position.hpp"
+#include "ecs/components/Velocity.hpp"
+#include "ecs/scheduler/Scheduler.hpp"
+
+TEST(Scheduler, dependencies_follow_access_sets)
+{
+    Ecs::Scheduler scheduler;
+    auto noop = [](Ecs::Registry &, Ecs::CommandBuffer &) {
+    };
+
+    scheduler.addSystem("movement", Ecs::Reads<Ecs::Velocity>{}, Ecs::Writes<Ecs::Position>{}, noop);
+    scheduler.addSystem("ai", Ecs::Reads<>{}, Ecs::Writes<Ecs::AIBrain>{}, noop);
+    scheduler.addSystem("cooldown", Ecs::Reads<>{}, Ecs::Writes<Ecs::Attack>{}, noop);
+    scheduler.addSystem("render", Ecs::Reads<Ecs::Position, Ecs::AIBrain>{}, Ecs::Writes<>{}, noop);
+    scheduler.addSystem("steer", Ecs::Reads<Ecs::AIBrain>{}, Ecs::Writes<Ecs::Velocity>{}, noop);
+
+    ASSERT_TRUE(scheduler.getDependencies(1).empty());
+    ASSERT_TRUE(scheduler.getDependencies(2).empty());
+    ASSERT_EQ(scheduler.getDependencies(3), (std::vector<size_t>{0, 1}));
+    ASSERT_EQ(scheduler.getDependencies(4), (std::vector<size_t>{0, 1}));
+}
+
+TEST(Scheduler, runs_systems_and_applies_commands)
+{
+    Ecs::Registry registry;
+    Ecs::Scheduler scheduler;
+    Thread::ThreadPool pool(2);
+
+    for (int i = 0; i < 100; ++i) {
+        auto e = registry.createEntity();
+        registry.emplaceComponent<Ecs::Position>(e, 0.f, 0.f);
+        registry.emplaceComponent<Ecs::Velocity>(e, 1.f, 0.f);
+        registry.emplaceComponent<Ecs::Health>(e, i < 10 ? 0 : 100);
+    }
+    scheduler.addSystem("movement", Ecs::Reads<Ecs::Velocity>{}, Ecs::Writes<Ecs::Position>{},
+        [](Ecs::Registry &reg, Ecs::CommandBuffer &) {
+            for (auto [e, pos, vel] : reg.view<Ecs::Position, const Ecs::Velocity>())
+                pos.x += vel.vx;
+        });
+    scheduler.addSystem("death", Ecs::Reads<Ecs::Health>{}, Ecs::Writes<>{},
+        [](Ecs::Registry &reg, Ecs::CommandBuffer &commands) {
+            reg.view<const Ecs::Health>([&](Ecs::Entity e, const Ecs::Health &health) {
+                if (health.hp <= 0)
+                    commands.destroyEntity(e);
+            });
+        });
+
+    scheduler.run(registry, pool);
+    scheduler.run(registry, pool);
+
+    ASSERT_EQ(registry.getComponents<Ecs::Health>().size(), 90);
+    for (auto [e, pos] : registry.view<Ecs::Position>())
+        ASSERT_EQ(pos.x, 2.f);
+    ASSERT_EQ(scheduler.getStats().size(), 2);
+    ASSERT_EQ(scheduler.getStats()[0].name, "movement");
+    ASSERT_EQ(scheduler.getStats()[0].runs, 2);
+    ASSERT_GE(scheduler.getLastTickDuration(), scheduler.getStats()[1].last);
+}
@@ -0,0 +1,204 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** testSerialization
+*/
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include "ecs/components/Drawable.hpp"
+#include "ecs/components/Health.hpp"
+#include "ecs/components/Position.hpp"
+#include "ecs/core/Registry.hpp"
+#include "ecs/serialization/BinaryReader.hpp"
+#include "ecs/serialization/BinaryWriter.hpp"
+
+namespace
+{
+    struct Dead {};
+
+    struct Unserializable {
+        std::vector<int> values;
+    };
+
+    struct Impostor {
+        int value = 0;
+    };
+
+    /**
+     * @brief Writes a snapshot of one entity index holding a single pool.
+     */
+    void writeSnapshot(Ecs::BinaryWriter &writer, uint64_t key, uint64_t count, const void *pool, size_t size)
+    {
+        const uint32_t generation = 0;
+
+        writer.write(Ecs::Registry::SNAPSHOT_MAGIC);
+        writer.write(uint64_t{1});
+        writer.write(&generation, sizeof(generation));
+        writer.write(uint64_t{0});
+        writer.write(uint64_t{1});
+        writer.write(key);
+        writer.write(count);
+        writer.write(pool, size);
+    }
+}
+
+/** Gives Impostor the key of Position, as two same-named types of different translation units would get. */
+template <>
+uint64_t Ecs::typeKey<Impostor>() noexcept
+{
+    return Ecs::typeKey<Ecs::Position>();
+}
+
+TEST(Serialization, writer_and_reader_round_trip)
+{
+    Ecs::BinaryWriter writer;
+
+    writer.write(uint32_t{42});
+    writer.writeString("ship.png");
+    writer.write(1.5f);
+
+    Ecs::BinaryReader reader(writer.data());
+
+    ASSERT_EQ(reader.read<uint32_t>(), 42u);
+    ASSERT_EQ(reader.readString(), "ship.png");
+    ASSERT_EQ(reader.read<float>(), 1.5f);
+    ASSERT_EQ(reader.remaining(), 0);
+    ASSERT_THROW(reader.read<uint8_t>(), std::out_of_range);
+}
+
+TEST(Serialization, registry_round_trip)
+{
+    Ecs::Registry source;
+    std::vector<Ecs::Entity> entities = source.createEntities(5);
+
+    for (Ecs::Entity e : entities)
+        source.emplaceComponent<Ecs::Position>(e, static_cast<float>(e.index()), 2.f);
+    source.emplaceComponent<Ecs::Health>(entities[1], 30, 100);
+    source.emplaceComponent<Ecs::Drawable>(entities[2], "boss.png", false);
+    source.emplaceComponent<Dead>(entities[3]);
+    source.destroyEntity(entities[4]);
+
+    Ecs::BinaryWriter writer;
+
+    source.serialize(writer);
+
+    Ecs::Registry target;
+
+    target.registerComponent<Dead>();
+    target.registerComponent<Ecs::Drawable>();
+    target.registerComponent<Ecs::Health>();
+    target.registerComponent<Ecs::Position>();
+    target.emplaceComponent<Ecs::Health>(target.createEntity(), 1, 1);
+
+    Ecs::BinaryReader reader(writer.data());
+
+    target.deserialize(reader);
+
+    ASSERT_EQ(reader.remaining(), 0);
+    ASSERT_FALSE(target.isAlive(entities[4]));
+    for (size_t i = 0; i < 4; ++i) {
+        ASSERT_TRUE(target.isAlive(entities[i]));
+        ASSERT_EQ(target.getSignature(entities[i]), source.getSignature(entities[i]));
+        ASSERT_EQ(target.getComponents<Ecs::Position>()[entities[i].index()]->x, static_cast<float>(i));
+    }
+    ASSERT_EQ(target.getComponents<Ecs::Health>().size(), 1);
+    ASSERT_EQ(target.getComponents<Ecs::Health>()[entities[1].index()]->hp, 30);
+    ASSERT_EQ(target.getComponents<Ecs::Drawable>()[entities[2].index()]->sprite, "boss.png");
+    ASSERT_FALSE(target.getComponents<Ecs::Drawable>()[entities[2].index()]->drawable);
+    ASSERT_TRUE(target.hasComponent<Dead>(entities[3]));
+    ASSERT_EQ(target.createEntity().index(), entities[4].index());
+}
+
+TEST(Serialization, restore_rebuilds_groups)
+{
+    Ecs::Registry registry;
+    std::vector<Ecs::Entity> entities = registry.createEntities(3);
+
+    for (Ecs::Entity e : entities)
+        registry.emplaceComponent<Ecs::Position>(e);
+    registry.emplaceComponent<Ecs::Health>(entities[2]);
+
+    Ecs::BinaryWriter writer;
+
+    registry.serialize(writer);
+    auto &group = registry.group<Ecs::Position, Ecs::Health>();
+
+    registry.emplaceComponent<Ecs::Health>(entities[0]);
+    ASSERT_EQ(group.size(), 2);
+
+    Ecs::BinaryReader reader(writer.data());
+
+    registry.deserialize(reader);
+    ASSERT_EQ(group.size(), 1);
+    ASSERT_EQ(group.entities()[0], entities[2].index());
+}
+
+TEST(Serialization, invalid_snapshots_are_rejected)
+{
+    Ecs::Registry source;
+
+    source.emplaceComponent<Ecs::Position>(source.createEntity());
+
+    Ecs::BinaryWriter writer;
+
+    source.serialize(writer);
+
+    Ecs::Registry unregistered;
+    Ecs::BinaryReader reader(writer.data());
+
+    unregistered.emplaceComponent<Ecs::Health>(unregistered.createEntity());
+    ASSERT_THROW(unregistered.deserialize(reader), std::invalid_argument);
+    ASSERT_EQ(unregistered.getComponents<Ecs::Health>().size(), 0);
+
+    std::vector<std::byte> truncated(writer.data().begin(), writer.data().end() - 4);
+    Ecs::Registry target;
+    Ecs::BinaryReader cut(truncated);
+
+    target.registerComponent<Ecs::Position>();
+    ASSERT_THROW(target.deserialize(cut), std::out_of_range);
+
+    Ecs::Registry opaque;
+    Ecs::BinaryWriter sink;
+
+    opaque.emplaceComponent<Unserializable>(opaque.createEntity());
+    ASSERT_THROW(opaque.serialize(sink), std::logic_error);
+}
+
+TEST(Serialization, colliding_type_keys_are_rejected)
+{
+    Ecs::Registry registry;
+
+    registry.registerComponent<Ecs::Position>();
+    ASSERT_THROW(registry.registerComponent<Impostor>(), std::logic_error);
+    ASSERT_NO_THROW(registry.registerComponent<Ecs::Position>());
+}
+
+TEST(Serialization, out_of_range_indices_are_rejected)
+{
+    struct {
+        size_t index = size_t{1} << 60;
+        Ecs::Position position = {1.f, 2.f};
+    } sparse;
+    Ecs::BinaryWriter huge;
+    Ecs::Registry target;
+
+    writeSnapshot(huge, Ecs::typeKey<Ecs::Position>(), 1, &sparse, sizeof(sparse));
+    target.registerComponent<Ecs::Position>();
+    Ecs::BinaryReader hugeReader(huge.data());
+
+    ASSERT_THROW(target.deserialize(hugeReader), std::invalid_argument);
+
+    const uint64_t words[2] = {0, 1};
+    Ecs::BinaryWriter tagged;
+    Ecs::Registry tags;
+
+    writeSnapshot(tagged, Ecs::typeKey<Dead>(), 2, words, sizeof(words));
+    tags.registerComponent<Dead>();
+    Ecs::BinaryReader taggedReader(tagged.data());
+
+    ASSERT_THROW(tags.deserialize(taggedReader), std::invalid_argument);
+}
@@ -0,0 +1,109 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** testSignal
+*/
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "ecs/core/Signal.hpp"
+
+namespace
+{
+    int total = 0;
+
+    void add(int value)
+    {
+        total += value;
+    }
+
+    struct Recorder {
+        std::vector<int> values;
+
+        void record(int value)
+        {
+            values.push_back(value);
+        }
+    };
+
+    struct Rewirer {
+        Ecs::Signal<int> &signal;
+        Recorder &skipped;
+        Recorder &next;
+        int calls = 0;
+
+        void rewire(int)
+        {
+            calls++;
+            signal.disconnect(this);
+            signal.disconnect(&skipped);
+            signal.connect<&Recorder::record>(next);
+            for (int i = 0; i < 64; ++i)
+                signal.connect<&add>();
+        }
+    };
+}
+
+TEST(Signal, publishes_to_functions_and_members)
+{
+    Ecs::Signal<int> signal;
+    Recorder recorder;
+
+    total = 0;
+    signal.connect<&add>();
+    signal.connect<&Recorder::record>(recorder);
+    signal.publish(3);
+    signal.publish(4);
+
+    ASSERT_EQ(signal.size(), 2);
+    ASSERT_EQ(total, 7);
+    ASSERT_EQ(recorder.values, (std::vector<int>{3, 4}));
+}
+
+TEST(Signal, disconnect_handlers)
+{
+    Ecs::Signal<int> signal;
+    Recorder first;
+    Recorder second;
+
+    total = 0;
+    signal.connect<&add>();
+    signal.connect<&Recorder::record>(first);
+    signal.connect<&Recorder::record>(second);
+
+    signal.disconnect<&Recorder::record>(first);
+    signal.publish(1);
+    signal.disconnect<&add>();
+    signal.disconnect(&second);
+    signal.publish(2);
+
+    ASSERT_TRUE(signal.empty());
+    ASSERT_EQ(total, 1);
+    ASSERT_TRUE(first.values.empty());
+    ASSERT_EQ(second.values, (std::vector<int>{1}));
+}
+
+TEST(Signal, handlers_rewire_during_publish)
+{
+    Ecs::Signal<int> signal;
+    Recorder skipped;
+    Recorder next;
+    Rewirer rewirer {signal, skipped, next};
+
+    total = 0;
+    signal.connect<&Rewirer::rewire>(rewirer);
+    signal.connect<&Recorder::record>(skipped);
+
+    signal.publish(1);
+    ASSERT_EQ(rewirer.calls, 1);
+    ASSERT_TRUE(skipped.values.empty());
+    ASSERT_TRUE(next.values.empty());
+    ASSERT_EQ(total, 0);
+    ASSERT_EQ(signal.size(), 65);
+
+    signal.publish(2);
+    ASSERT_EQ(rewirer.calls, 1);
+    ASSERT_EQ(next.values, (std::vector<int>{2}));
+    ASSERT_EQ(total, 128);
+}
@@ -6,6 +6,7 @@
 */
 
 #include <gtest/gtest.h>
+#include <string>
 #include "ecs/core/SparseArray.hpp"
 
 TEST(SparseArray, insert_and_access)
@@ -38,3 +39,16 @@ TEST(SparseArray, remove)
 
     ASSERT_FALSE(arr[3].has_value());
 }
+
+TEST(SparseArray, emplace_and_move_insert)
+{
+    Ecs::SparseArray<std::string> arr;
+
+    arr.emplace(2, 3, 'x');
+    arr.insert(0, std::string("moved"));
+
+    ASSERT_EQ(arr.size(), 3);
+    ASSERT_EQ(arr[2].value(), "xxx");
+    ASSERT_EQ(arr[0].value(), "moved");
+    ASSERT_FALSE(arr[1].has_value());
+}
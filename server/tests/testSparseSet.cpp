@@ -0,0 +1,186 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** testSparseSet
+*/
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "ecs/core/SparseSet.hpp"
+
+TEST(SparseSet, insert_and_access)
+{
+    Ecs::SparseSet<int> set;
+
+    set.insert(5, 42);
+
+    ASSERT_EQ(set.size(), 1);
+    ASSERT_TRUE(set.contains(5));
+    ASSERT_NE(set[5], nullptr);
+    ASSERT_EQ(*set[5], 42);
+}
+
+TEST(SparseSet, out_of_bounds_is_empty)
+{
+    Ecs::SparseSet<int> set;
+
+    ASSERT_TRUE(set.empty());
+    ASSERT_FALSE(set.contains(42));
+    ASSERT_EQ(set[42], nullptr);
+}
+
+TEST(SparseSet, remove_keeps_dense_packed)
+{
+    Ecs::SparseSet<int> set;
+    set.insert(1, 10);
+    set.insert(7, 70);
+    set.insert(3, 30);
+
+    set.remove(1);
+
+    ASSERT_EQ(set.size(), 2);
+    ASSERT_FALSE(set.contains(1));
+    ASSERT_EQ(*set[7], 70);
+    ASSERT_EQ(*set[3], 30);
+    ASSERT_EQ(set.entities()[0], 3);
+    ASSERT_EQ(set.components()[0], 30);
+}
+
+TEST(SparseSet, insert_replaces_existing)
+{
+    Ecs::SparseSet<int> set;
+    set.insert(2, 1);
+    set.insert(2, 5);
+
+    ASSERT_EQ(set.size(), 1);
+    ASSERT_EQ(*set[2], 5);
+}
+
+TEST(SparseSet, change_tracking)
+{
+    Ecs::SparseSet<int> set;
+    set.insert(1, 10);
+    set.setTracking(true);
+
+    set.insert(2, 20);
+    set.insert(3, 30);
+    *set[1] += 1;
+    *set[1] += 1;
+    set.remove(3);
+
+    ASSERT_EQ(set.added(), (std::vector<size_t>{2, 3}));
+    ASSERT_EQ(set.removed(), (std::vector<size_t>{3}));
+    ASSERT_EQ(set.changed(), (std::vector<size_t>{2, 3, 1}));
+    ASSERT_TRUE(set.isChanged(1));
+
+    set.clearChanges();
+    const auto &constSet = set;
+    ASSERT_EQ(*constSet[2], 20);
+
+    ASSERT_TRUE(set.changed().empty());
+    ASSERT_TRUE(set.added().empty());
+    ASSERT_FALSE(set.isChanged(2));
+}
+
+namespace
+{
+    struct Counted {
+        static inline int copies = 0;
+
+        Counted(int v) : value(v)
+        {
+        }
+
+        Counted(const Counted &other) : value(other.value)
+        {
+            copies++;
+        }
+
+        Counted(Counted &&) noexcept = default;
+        Counted &operator=(const Counted &) = default;
+        Counted &operator=(Counted &&) noexcept = default;
+
+        int value = 0;
+    };
+} // namespace
+
+TEST(SparseSet, emplace_and_move_insert_do_not_copy)
+{
+    Ecs::SparseSet<Counted> set;
+    Counted::copies = 0;
+
+    set.reserve(4);
+    set.emplace(0, 1);
+    set.insert(1, Counted(2));
+    set.emplace(0, 3);
+    set.emplace(1, Counted(4));
+
+    ASSERT_EQ(Counted::copies, 0);
+    ASSERT_EQ(set[0]->value, 3);
+    ASSERT_EQ(set[1]->value, 4);
+}
+
+TEST(SparseSet, sparse_pages_follow_population)
+{
+    Ecs::SparseSet<int> set;
+
+    set.insert(1000000, 1);
+    set.insert(1000001, 2);
+    set.insert(3, 3);
+
+    ASSERT_EQ(set.pageCount(), 2);
+    ASSERT_EQ(*set[1000001], 2);
+    ASSERT_FALSE(set.contains(999999));
+
+    set.remove(1000000);
+    set.remove(1000001);
+
+    ASSERT_EQ(set.pageCount(), 1);
+    ASSERT_FALSE(set.contains(1000001));
+    ASSERT_EQ(*set[3], 3);
+}
+
+TEST(SparseSet, clone_shares_pages_copy_on_write)
+{
+    Ecs::SparseSet<int> set;
+
+    set.insert(3, 30);
+    set.insert(2000, 42);
+
+    std::unique_ptr<Ecs::ISparseSet> copy = set.clone();
+    auto &clone = static_cast<Ecs::SparseSet<int> &>(*copy);
+
+    clone.remove(3);
+    clone.insert(2001, 7);
+    *clone[2000] = 0;
+
+    ASSERT_TRUE(set.contains(3));
+    ASSERT_FALSE(set.contains(2001));
+    ASSERT_EQ(*set[2000], 42);
+    ASSERT_EQ(set.denseIndex(2000), 1);
+    ASSERT_FALSE(clone.contains(3));
+    ASSERT_EQ(clone.size(), 2);
+    ASSERT_EQ(*clone[2001], 7);
+}
+
+TEST(SparseSet, compact_sorts_and_shrinks)
+{
+    Ecs::SparseSet<int> set;
+
+    set.reserve(64);
+    for (size_t index : {9ul, 3ul, 7ul, 1ul, 5ul})
+        set.insert(index, static_cast<int>(index) * 10);
+    set.insert(5000, 1);
+    set.remove(5000);
+
+    ASSERT_GT(set.stats().fragmentation(), 0.5);
+    set.compact(2);
+
+    ASSERT_EQ(set.entities(), (std::vector<size_t>{3, 9, 1, 5, 7}));
+    for (size_t index : {1ul, 3ul, 5ul, 7ul, 9ul})
+        ASSERT_EQ(*set[index], static_cast<int>(index) * 10);
+    ASSERT_EQ(set.stats().live, 5);
+    ASSERT_EQ(set.stats().slots, Ecs::SparseSet<int>::PAGE_SIZE);
+    ASSERT_EQ(set.components().capacity(), 5);
+}
@@ -0,0 +1,48 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** testSweepAndPrune
+*/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+#include "PhysicsHelpers.hpp"
+#include "physics/SweepAndPrune/SweepAndPrune.hpp"
+#include "physics/UniformGrid/UniformGrid.hpp"
+
+using PhysicsHelpers::overlappingPairs;
+using PhysicsHelpers::spawn;
+
+TEST(SweepAndPrune, matches_uniform_grid_across_ticks)
+{
+    Ecs::Registry registry;
+    Physics::SweepAndPrune sweep;
+    Physics::UniformGrid grid({0.f, 0.f, 800.f, 600.f}, 64.f);
+    std::vector<Ecs::Entity> entities;
+
+    for (size_t i = 0; i < 200; ++i)
+        entities.push_back(spawn(registry, static_cast<float>(i * 37 % 800), static_cast<float>(i * 53 % 600),
+            static_cast<float>(4 + i % 5 * 20), static_cast<float>(4 + i % 3 * 30)));
+    for (size_t tick = 0; tick < 4; ++tick) {
+        sweep.update(registry);
+        grid.update(registry);
+
+        ASSERT_EQ(sweep.getPairs().size(), overlappingPairs(sweep).size());
+        ASSERT_EQ(overlappingPairs(sweep), overlappingPairs(grid));
+        auto byLeftEdge = [&sweep](uint32_t lhs, uint32_t rhs) {
+            return sweep.getProxies()[lhs].box.minX < sweep.getProxies()[rhs].box.minX;
+        };
+
+        ASSERT_TRUE(std::is_sorted(sweep.getOrder().begin(), sweep.getOrder().end(), byLeftEdge));
+        registry.view<Ecs::Position>().each([](Ecs::Entity, Ecs::Position &pos) {
+            pos.x -= 3.f;
+        });
+        registry.destroyEntity(entities[tick * 7]);
+        spawn(registry, 400.f, 300.f, 30.f, 30.f);
+    }
+    ASSERT_EQ(sweep.getShifts(), 0u);
+    ASSERT_EQ(sweep.getStats().ticks, 4u);
+    ASSERT_EQ(sweep.getStats().proxies, 200u);
+}
@@ -0,0 +1,49 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** testTagSet
+*/
+
+#include <gtest/gtest.h>
+#include "ecs/core/TagSet.hpp"
+
+namespace
+{
+    struct Frozen {};
+}
+
+TEST(TagSet, insert_and_remove)
+{
+    Ecs::TagSet<Frozen> set;
+
+    set.insert(3);
+    set.emplace(70);
+    set.emplace(70);
+
+    ASSERT_EQ(set.size(), 2);
+    ASSERT_TRUE(set.contains(3));
+    ASSERT_TRUE(set.contains(70));
+    ASSERT_FALSE(set.contains(4));
+    ASSERT_EQ(set.wordCount(), 2);
+    ASSERT_EQ(set.word(1), uint64_t{1} << 6);
+
+    set.remove(3);
+    set.remove(3);
+
+    ASSERT_EQ(set.size(), 1);
+    ASSERT_FALSE(set.contains(3));
+    ASSERT_EQ(set[3], nullptr);
+    ASSERT_NE(set[70], nullptr);
+}
+
+TEST(TagSet, out_of_bounds_is_empty)
+{
+    Ecs::TagSet<Frozen> set;
+
+    ASSERT_TRUE(set.empty());
+    ASSERT_FALSE(set.contains(1000));
+    ASSERT_EQ(set.word(42), 0);
+    set.remove(1000);
+    ASSERT_EQ(set.size(), 0);
+}
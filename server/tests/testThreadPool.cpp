@@ -0,0 +1,64 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** testThreadPool
+*/
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include "thread/ThreadPool/ThreadPool.hpp"
+
+TEST(ThreadPool, parallel_for_covers_every_item_once)
+{
+    Thread::ThreadPool pool(4);
+    std::vector<std::atomic<int>> hits(10000);
+
+    pool.parallelFor(hits.size(), 64, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+            hits[i].fetch_add(1);
+    });
+
+    for (auto &hit : hits)
+        ASSERT_EQ(hit.load(), 1);
+}
+
+TEST(ThreadPool, runs_inline_without_workers)
+{
+    Thread::ThreadPool pool(0);
+    size_t total = 0;
+
+    pool.parallelFor(100, 7, [&](size_t begin, size_t end) {
+        total += end - begin;
+    });
+
+    ASSERT_EQ(pool.workerCount(), 0);
+    ASSERT_EQ(total, 100);
+}
+
+TEST(ThreadPool, rethrows_chunk_exception)
+{
+    Thread::ThreadPool pool(2);
+
+    ASSERT_THROW(pool.parallelFor(100, 10,
+                     [](size_t begin, size_t) {
+                         if (begin == 50)
+                             throw std::runtime_error("chunk failed");
+                     }),
+        std::runtime_error);
+}
+
+TEST(ThreadPool, submit_runs_tasks)
+{
+    std::atomic<int> counter = 0;
+    {
+        Thread::ThreadPool pool(2);
+        for (int i = 0; i < 100; ++i)
+            pool.submit([&counter]() {
+                counter.fetch_add(1);
+            });
+    }
+    ASSERT_EQ(counter.load(), 100);
+}
@@ -0,0 +1,90 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** testUniformGrid
+*/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include "PhysicsHelpers.hpp"
+#include "physics/UniformGrid/UniformGrid.hpp"
+
+using PhysicsHelpers::overlappingPairs;
+using PhysicsHelpers::spawn;
+
+namespace
+{
+    const Physics::Aabb WORLD = {0.f, 0.f, 800.f, 600.f};
+}
+
+TEST(UniformGrid, finds_every_overlap_once)
+{
+    Ecs::Registry registry;
+    Physics::UniformGrid grid(WORLD, 64.f);
+
+    registry.registerComponent<Ecs::Position>();
+    registry.registerComponent<Ecs::Collision>();
+    for (size_t i = 0; i < 300; ++i)
+        spawn(registry, static_cast<float>(i * 37 % 820) - 10.f, static_cast<float>(i * 53 % 610) - 5.f,
+            static_cast<float>(4 + i % 5 * 30), static_cast<float>(4 + i % 3 * 50));
+    grid.update(registry);
+
+    const auto &proxies = grid.getProxies();
+    std::set<std::pair<size_t, size_t>> expected;
+
+    for (size_t a = 0; a < proxies.size(); ++a)
+        for (size_t b = a + 1; b < proxies.size(); ++b)
+            if (proxies[a].box.overlaps(proxies[b].box))
+                expected.emplace(std::min(proxies[a].entity.index(), proxies[b].entity.index()),
+                    std::max(proxies[a].entity.index(), proxies[b].entity.index()));
+
+    std::set<std::pair<uint32_t, uint32_t>> unique;
+
+    for (const auto &[first, second] : grid.getPairs()) {
+        ASSERT_LT(first, second);
+        ASSERT_TRUE(unique.emplace(first, second).second);
+    }
+    ASSERT_EQ(overlappingPairs(grid), expected);
+    ASSERT_EQ(grid.getStats().proxies, 300u);
+    ASSERT_EQ(grid.getStats().pairs, grid.getPairs().size());
+    ASSERT_GE(grid.getStats().tests, grid.getStats().pairs);
+    ASSERT_LT(grid.getStats().tests, 300u * 299u / 2u);
+}
+
+TEST(UniformGrid, cells_and_stats)
+{
+    Ecs::Registry registry;
+    Physics::UniformGrid grid(WORLD, 100.f);
+
+    ASSERT_EQ(grid.getColumns(), 8u);
+    ASSERT_EQ(grid.getRows(), 6u);
+    ASSERT_EQ(grid.columnOf(-50.f), 0u);
+    ASSERT_EQ(grid.columnOf(5000.f), 7u);
+    ASSERT_EQ(grid.rowOf(250.f), 2u);
+    spawn(registry, 90.f, 90.f, 20.f, 20.f);
+    spawn(registry, 95.f, 95.f, 20.f, 20.f);
+    spawn(registry, 500.f, 500.f, 10.f, 10.f);
+    grid.update(registry);
+    grid.update(registry);
+
+    ASSERT_EQ(grid.getCell(0, 0).size(), 2u);
+    ASSERT_EQ(grid.getCell(1, 1).size(), 2u);
+    ASSERT_EQ(grid.getCell(5, 5).size(), 1u);
+    ASSERT_TRUE(grid.getCell(8, 0).empty());
+    ASSERT_EQ(grid.getPairs().size(), 1u);
+    ASSERT_EQ(grid.getStats().ticks, 2u);
+    ASSERT_EQ(grid.getStats().totalPairs, 2u);
+    ASSERT_DOUBLE_EQ(grid.getStats().averagePairs(), 1.0);
+
+    grid.setCellSize(400.f);
+    grid.update(registry);
+    ASSERT_EQ(grid.getColumns(), 2u);
+    ASSERT_EQ(grid.getCell(0, 0).size(), 2u);
+    ASSERT_EQ(grid.getPairs().size(), 1u);
+    ASSERT_THROW(grid.setCellSize(0.f), std::invalid_argument);
+    ASSERT_THROW(Physics::UniformGrid(WORLD, 0.001f), std::invalid_argument);
+}